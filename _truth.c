@@ -12,11 +12,14 @@
  *
  * @info: Pointer to the info struct.
  *
+ * The answer cannot change while the shell runs, so main() works it out
+ * once rather than paying an isatty() call on every check.
+ *
  * Return: 1 if interactive; 0 otherwise.
  */
 int interactive(info_t *info)
 {
-	return (isatty(STDIN_FILENO) && info->readfd <= 2);
+	return (info->is_tty);
 }
 
 /**
@@ -89,3 +92,33 @@ int _atoi(char *s)
 
 	return (output);
 }
+
+/**
+ * _atol - Parses a whole signed decimal number.
+ *
+ * @s: The string, an optional sign followed only by digits.
+ * @n: Where the number is stored.
+ *
+ * Return: 0 on success, 1 if @s is not a number or does not fit a long.
+ */
+int _atol(char *s, long *n)
+{
+	unsigned long v = 0, lim = LONG_MAX;
+	int neg = 0;
+
+	if (*s == '-' || *s == '+')
+		neg = *s++ == '-';
+	if (!*s)
+		return (1);
+	lim += neg;
+	for (; *s >= '0' && *s <= '9'; s++)
+	{
+		if (v > (lim - (*s - '0')) / 10)
+			return (1);
+		v = v * 10 + (*s - '0');
+	}
+	if (*s)
+		return (1);
+	*n = neg ? (long)(0 - v) : (long)v;
+	return (0);
+}
@@ -0,0 +1,98 @@
+/*
+ * File_name: arena.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * arena_alloc - Carves n bytes out of a bump-pointer arena.
+ *
+ * @a: The arena.
+ * @n: The number of bytes wanted.
+ *
+ * When the current block is full a block twice its size is chained in
+ * front of it. Every block starts with ARENA_ALIGN bytes holding the
+ * address of the block before it.
+ *
+ * Return: Pointer to the memory, aligned to ARENA_ALIGN, or NULL.
+ */
+void *arena_alloc(arena_t *a, size_t n)
+{
+	size_t size;
+	char *block;
+
+	n = (n + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+	if (a->used + n > a->size)
+	{
+		size = a->size ? a->size * 2 : ARENA_SIZE;
+		while (size < n + ARENA_ALIGN)
+			size *= 2;
+		block = malloc(size);
+		if (!block)
+			return (NULL);
+		*(char **)block = a->base;
+		a->base = block;
+		a->size = size;
+		a->used = ARENA_ALIGN;
+	}
+	a->used += n;
+	return (a->base + a->used - n);
+}
+
+/**
+ * arena_strdup - Copies a string into an arena.
+ *
+ * @a: The arena.
+ * @str: The string to copy.
+ *
+ * Return: The copy, or NULL if @str is NULL or the arena cannot grow.
+ */
+char *arena_strdup(arena_t *a, const char *str)
+{
+	char *ret;
+
+	if (!str)
+		return (NULL);
+	ret = arena_alloc(a, _strlen((char *)str) + 1);
+	if (ret)
+		_strcpy(ret, (char *)str);
+	return (ret);
+}
+
+/**
+ * arena_reset - Releases everything allocated from an arena at once.
+ *
+ * @a: The arena.
+ *
+ * Only the newest, largest block is kept, so once it has grown to fit
+ * a typical command, later commands allocate nothing from the heap.
+ */
+void arena_reset(arena_t *a)
+{
+	char *block, *prev;
+
+	if (!a->base)
+		return;
+	for (block = *(char **)a->base; block; block = prev)
+	{
+		prev = *(char **)block;
+		free(block);
+	}
+	*(char **)a->base = NULL;
+	a->used = ARENA_ALIGN;
+}
+
+/**
+ * arena_free - Releases an arena and all of its blocks.
+ *
+ * @a: The arena.
+ */
+void arena_free(arena_t *a)
+{
+	arena_reset(a);
+	free(a->base);
+	a->base = NULL;
+	a->size = a->used = 0;
+}
@@ -52,10 +52,8 @@ char *_strncat(char *dest, char *src, int n)
 	int i, j;
 	char *s = dest;
 
-	i = 0;
+	i = _strlen(dest);
 	j = 0;
-	while (dest[i] != '\0')
-		i++;
 	while (src[j] != '\0' && j < n)
 	{
 		dest[i] = src[j];
@@ -72,7 +70,8 @@ char *_strncat(char *dest, char *src, int n)
  *
  * This function scans a string for the first occurrence of the
  * specified character @c and returns a pointer to the memory
- * location where it's found within the string @s.
+ * location where it's found within the string @s. Like _strlen() it
+ * scans with the widest str_chr() the CPU has.
  *
  * @s: The string to be searched.
  * @c: The character to locate.
@@ -82,10 +81,49 @@ char *_strncat(char *dest, char *src, int n)
  */
 char *_strchr(char *s, char c)
 {
-	do {
+	return (str_chr(s, c));
+}
+
+/**
+ * _strncmp - Compares at most n characters of two strings.
+ *
+ * @s1: The first string to compare.
+ * @s2: The second string to compare.
+ * @n: The maximum number of characters to compare.
+ *
+ * Return: 0 if the first @n characters match, otherwise the difference
+ *         of the first pair of characters that do not.
+ */
+int _strncmp(char *s1, char *s2, size_t n)
+{
+	for (; n && *s1 && *s1 == *s2; n--, s1++, s2++)
+		;
+	if (!n)
+		return (0);
+	return ((unsigned char)*s1 - (unsigned char)*s2);
+}
+
+/**
+ * _memchr - Searches the first n bytes of a buffer for a character.
+ *
+ * @s: The buffer to be searched; it need not be NUL-terminated.
+ * @c: The character to locate.
+ * @n: The number of bytes to search.
+ *
+ * Return: A pointer to the first @c within @n bytes of @s, or NULL.
+ */
+char *_memchr(char *s, char c, size_t n)
+{
+	word_t mask = WORD_ONES * (unsigned char)c;
+
+	for (; n && !WORD_ALIGNED(s); s++, n--)
+		if (*s == c)
+			return (s);
+	for (; n >= WORD_SIZE; s += WORD_SIZE, n -= WORD_SIZE)
+		if (WORD_HAS_ZERO(*(word_t *)s ^ mask))
+			break;
+	for (; n; s++, n--)
 		if (*s == c)
 			return (s);
-	} while (*s++ != '\0');
-
 	return (NULL);
 }
@@ -0,0 +1,36 @@
+#!/bin/sh
+#
+# File_name: batch.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Times the batch builtin passing 300k items, read from a file, to
+# /bin/echo in as few commands as ARG_MAX allows, and the same through
+# xargs for reference. parallel -j 1 on 2000 of the items shows what
+# one command per item would cost.
+#
+# Usage: bench/batch.sh [path/to/hsh] [items]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+n=${2:-300000}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+seq 1 "$n" | sed 's/^/item-/' > "$dir/items"
+head -n 2000 "$dir/items" > "$dir/some"
+
+# ms line: runs the line in hsh, prints milliseconds
+ms()
+{
+	start=$(date +%s%N)
+	printf '%s\n' "$1" > "$dir/run.sh"
+	"$hsh" "$dir/run.sh" > /dev/null 2>&1
+	echo $(( ($(date +%s%N) - start) / 1000000 ))
+}
+
+one="parallel -j 1 /bin/echo < $dir/some"
+echo "batch, $n items:    $(ms "batch /bin/echo < $dir/items") ms"
+echo "xargs, $n items:    $(ms "xargs /bin/echo < $dir/items") ms"
+echo "parallel -j 1, 2000 items: $(ms "$one") ms"
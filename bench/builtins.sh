@@ -0,0 +1,42 @@
+#!/bin/sh
+#
+# File_name: builtins.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Times echo, printf, test, pwd, true and false run by hsh as builtins
+# and, by full path, as the external commands they replace.
+#
+# Usage: bench/builtins.sh [path/to/hsh] [lines]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+n=${2:-100000}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+# lines prefix count: writes the mixed commands, each name after prefix
+lines()
+{
+	awk -v p="$1" -v n="$2" 'BEGIN {
+		split("echo hello world|printf %s-%d\\n a 1|test 3 -lt 5" \
+			"|pwd|true|false", cmd, "|")
+		for (i = 0; i < n; i++)
+			print p cmd[i % 6 + 1]
+	}'
+}
+
+# us file count: runs hsh on the file, prints microseconds per line
+us()
+{
+	start=$(date +%s%N)
+	"$hsh" "$1" > /dev/null 2>&1
+	echo $(( ($(date +%s%N) - start) / 1000 / $2 ))
+}
+
+m=$((n / 50))
+lines "" "$n" > "$dir/builtin.sh"
+lines /usr/bin/ "$m" > "$dir/external.sh"
+echo "builtins: $(us "$dir/builtin.sh" "$n") us per line ($n lines)"
+echo "external: $(us "$dir/external.sh" "$m") us per line ($m lines)"
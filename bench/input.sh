@@ -0,0 +1,41 @@
+#!/bin/sh
+#
+# File_name: input.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Times hsh reading 1M lines from a pipe: short commands, comments, and
+# a few long lines, so the line buffer has to grow and slide. sh runs
+# the same input for reference.
+#
+# Usage: bench/input.sh [path/to/hsh] [lines]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+n=${2:-1000000}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+awk -v n="$n" 'BEGIN {
+	long = sprintf("%5000s", ""); gsub(/ /, "x", long)
+	for (i = 1; i <= n; i++)
+		if (i % 100000 == 0)
+			print "true " long
+		else if (i % 2)
+			print "true"
+		else
+			print "# a comment line"
+}' > "$dir/in.sh"
+
+# ms command...: runs the command on the input, prints milliseconds
+ms()
+{
+	start=$(date +%s%N)
+	cat "$dir/in.sh" | "$@" > /dev/null 2>&1
+	echo $(( ($(date +%s%N) - start) / 1000000 ))
+}
+
+echo "$n lines through a pipe"
+echo "hsh: $(ms "$hsh") ms"
+echo "sh:  $(ms sh) ms"
@@ -0,0 +1,49 @@
+#!/bin/sh
+#
+# File_name: lexer.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Times hsh tokenizing a large script (default 8 MB) of long lines, each
+# a chain of 30 builtins joined by ;, && and ||, with quoted words full
+# of operators and blanks. Every command is true, so almost all of the
+# time goes to splitting the lines; sh runs the same file for reference.
+#
+# Usage: bench/lexer.sh [path/to/hsh] [MB]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+mb=${2:-8}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+awk -v mb="$mb" 'BEGIN {
+	q = "\047"
+	while (size < mb * 1048576)
+	{
+		line = "true start"
+		for (i = 0; i < 30; i++)
+			line = line (i % 3 == 0 ? " ; " : i % 3 == 1 ? " && " \
+				: " || ") "true \"a;b|c&&d\" " q "e || f > g" q \
+				" x\"y z\"" q "w" q " plain word"
+		print line
+		size += length(line) + 1
+	}
+}' > "$dir/lex.sh"
+
+# ms command...: runs the command, prints milliseconds
+ms()
+{
+	start=$(date +%s%N)
+	"$@" > /dev/null 2>&1
+	echo $(( ($(date +%s%N) - start) / 1000000 ))
+}
+
+bytes=$(wc -c < "$dir/lex.sh")
+echo "$(wc -l < "$dir/lex.sh") lines of $((bytes / $(wc -l < "$dir/lex.sh")))" \
+	"bytes, $((bytes / 1048576)) MB"
+t=$(ms "$hsh" "$dir/lex.sh")
+echo "hsh: $t ms, $((bytes / 1024 / (t + 1))) MB/s"
+t=$(ms sh "$dir/lex.sh")
+echo "sh:  $t ms, $((bytes / 1024 / (t + 1))) MB/s"
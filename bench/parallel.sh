@@ -0,0 +1,35 @@
+#!/bin/sh
+#
+# File_name: parallel.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Times the parallel builtin at several -j: 16 items of "sleep 0.1",
+# where the wall time should fall with -j, and 2000 items of
+# /bin/true, where the cost of starting each command dominates.
+#
+# Usage: bench/parallel.sh [path/to/hsh]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+# ms line: runs the line in hsh, prints milliseconds
+ms()
+{
+	start=$(date +%s%N)
+	printf '%s\n' "$1" | "$hsh" > /dev/null 2>&1
+	echo $(( ($(date +%s%N) - start) / 1000000 ))
+}
+
+sleeps=$(seq 1 16 | sed 's/.*/0.1/' | tr '\n' ' ')
+trues=$(seq 1 2000 | tr '\n' ' ')
+for j in 1 4 16; do
+	echo "sleep 0.1 x16, -j $j: $(ms "parallel -j $j sleep ::: $sleeps") ms"
+done
+for j in 1 0; do
+	line="parallel -j $j /bin/true ::: $trues"
+	echo "/bin/true x2000, -j $j: $(ms "$line") ms"
+done
@@ -0,0 +1,43 @@
+#!/bin/sh
+#
+# File_name: pipeline.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Times pipelines run by hsh: the printf builtin feeding cat, which the
+# shell runs itself, against /usr/bin/printf in its place, and a wide
+# pipeline of 16 stages, all started at once.
+#
+# Usage: bench/pipeline.sh [path/to/hsh] [lines]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+n=${2:-2000}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+# us count line: runs the line count times in hsh, prints us per line
+us()
+{
+	i=0
+	while [ $i -lt "$1" ]; do
+		printf "%s\n" "$2"
+		i=$((i + 1))
+	done > "$dir/run.sh"
+	start=$(date +%s%N)
+	"$hsh" "$dir/run.sh" > /dev/null 2>&1
+	echo $(( ($(date +%s%N) - start) / 1000 / $1 ))
+}
+
+wide="echo x"
+i=1
+while [ $i -lt 16 ]; do
+	wide="$wide | cat"
+	i=$((i + 1))
+done
+in="printf '%s\n' a b c | cat"
+out="/usr/bin/printf '%s\n' a b c | cat"
+echo "builtin printf | cat:  $(us "$n" "$in") us per line"
+echo "/usr/bin/printf | cat: $(us "$n" "$out") us per line"
+echo "16 stages:             $(us $((n / 10)) "$wide") us per line"
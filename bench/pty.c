@@ -0,0 +1,48 @@
+/*
+ * File_name: pty.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include <pty.h>
+#include <stdio.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * main - Runs a command on a new terminal, typing "exit" into it.
+ *
+ * @ac: The argument count.
+ * @av: pty command [arg...]
+ *
+ * The command sees a terminal on its stdin, stdout and stderr, so a
+ * shell started this way is interactive. Its output is read and thrown
+ * away until it exits. Build with: cc -o pty bench/pty.c -lutil
+ *
+ * Return: The command's exit status, or 127 if it cannot be started.
+ */
+int main(int ac, char **av)
+{
+	char buf[4096];
+	int m, st;
+	pid_t pid;
+
+	if (ac < 2)
+		return (fprintf(stderr, "usage: pty command...\n"), 2);
+	pid = forkpty(&m, NULL, NULL, NULL);
+	if (pid == -1)
+		return (perror("forkpty"), 127);
+	if (pid == 0)
+	{
+		execvp(av[1], av + 1);
+		perror(av[1]);
+		_exit(127);
+	}
+	if (write(m, "exit\n", 5) != 5)
+		return (perror("write"), 127);
+	while (read(m, buf, sizeof(buf)) > 0)
+		;
+	if (waitpid(pid, &st, 0) == -1)
+		return (perror("waitpid"), 127);
+	return (WIFEXITED(st) ? WEXITSTATUS(st) : 128 + WTERMSIG(st));
+}
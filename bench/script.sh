@@ -0,0 +1,39 @@
+#!/bin/sh
+#
+# File_name: script.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Times hsh running a large script file (3M lines, about 100 MB) named
+# on the command line, which it maps, and fed on stdin, which it reads.
+# sh runs the same file for reference.
+#
+# Usage: bench/script.sh [path/to/hsh] [lines]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+n=${2:-3000000}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+awk -v n="$n" 'BEGIN {
+	for (i = 1; i <= n; i++)
+		if (i % 3)
+			print "# comment " i " padding out the line a little"
+		else
+			print "true " i
+}' > "$dir/big.sh"
+
+# ms command...: runs the command, prints milliseconds
+ms()
+{
+	start=$(date +%s%N)
+	"$@" > /dev/null 2>&1
+	echo $(( ($(date +%s%N) - start) / 1000000 ))
+}
+
+echo "$n lines, $(($(wc -c < "$dir/big.sh") / 1048576)) MB"
+echo "hsh file:  $(ms "$hsh" "$dir/big.sh") ms"
+echo "hsh stdin: $(ms "$hsh" < "$dir/big.sh") ms"
+echo "sh file:   $(ms sh "$dir/big.sh") ms"
@@ -0,0 +1,37 @@
+#!/bin/sh
+#
+# File_name: spawn.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Times hsh launching /bin/true n times from a script, built once with
+# the fork() engine (-DUSE_SPAWN=0) and once with posix_spawn()
+# (-DUSE_SPAWN=1). Both shells are built from this tree.
+#
+# Usage: bench/spawn.sh [launches]
+
+n=${1:-5000}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+build="$(dirname "$0")/../tests/build.sh"
+mkdir "$dir/fork" "$dir/spawn"
+fork=$(CFLAGS="$CFLAGS -DUSE_SPAWN=0" "$build" "" "$dir/fork") || exit 1
+spawn=$(CFLAGS="$CFLAGS -DUSE_SPAWN=1" "$build" "" "$dir/spawn") || exit 1
+
+i=0
+while [ $i -lt "$n" ]; do
+	echo /bin/true
+	i=$((i + 1))
+done > "$dir/run.sh"
+
+# us shell: runs the script in shell, prints us per launch
+us()
+{
+	start=$(date +%s%N)
+	"$1" "$dir/run.sh" > /dev/null 2>&1
+	echo $(( ($(date +%s%N) - start) / 1000 / n ))
+}
+
+echo "$n launches of /bin/true"
+echo "fork():        $(us "$fork") us each"
+echo "posix_spawn(): $(us "$spawn") us each"
@@ -0,0 +1,54 @@
+#!/bin/sh
+#
+# File_name: startup.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Times hsh starting and exiting with a large ~/.simple_shell_history
+# (default 4096 lines, the most it keeps) and with none but what the
+# timed runs save: running a one-line script, reading it from a pipe,
+# and interactive on a terminal made by bench/pty.c. Only the
+# interactive shell loads and saves the history, so only it should
+# slow down with a big file.
+#
+# Usage: bench/startup.sh [path/to/hsh] [runs] [history lines]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+runs=${2:-200}
+lines=${3:-4096}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+cc -o "$dir/pty" "$(dirname "$0")/pty.c" -lutil || exit 1
+mkdir "$dir/big" "$dir/none"
+echo exit > "$dir/exit.sh"
+# a full history stays full: each save drops as many lines as it adds
+awk -v n="$lines" 'BEGIN {
+	for (i = 1; i <= n; i++)
+		print "echo history line " i
+}' > "$dir/big/.simple_shell_history"
+
+# us how home: starts hsh runs times as how says, prints us per start
+us()
+{
+	i=0
+	start=$(date +%s%N)
+	while [ $i -lt "$runs" ]; do
+		case $1 in
+		script) HOME=$2 "$hsh" "$dir/exit.sh" ;;
+		pipe) echo exit | HOME=$2 "$hsh" ;;
+		*) HOME=$2 "$dir/pty" "$hsh" ;;
+		esac
+		i=$((i + 1))
+	done > /dev/null 2>&1
+	echo $(( ($(date +%s%N) - start) / 1000 / runs ))
+}
+
+echo "$runs starts each, $lines history lines"
+for how in script pipe interactive; do
+	big=$(us $how "$dir/big")
+	none=$(us $how "$dir/none")
+	printf '%-12s %6d us with history, %6d us without\n' $how $big $none
+done
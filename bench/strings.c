@@ -0,0 +1,102 @@
+/*
+ * File_name: strings.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "../shell.h"
+#include <stdio.h>
+#include <string.h>
+
+#define ROUNDS	2000000L
+
+static volatile size_t sink;
+
+/**
+ * now_ns - Reads the monotonic clock.
+ *
+ * Return: The time in nanoseconds, from an arbitrary start.
+ */
+static long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+/**
+ * run - Times one string function on one string.
+ *
+ * @what: Which function: 0-2 _strlen, _strchr, _strcmp; 3-5 the libc
+ *        ones; 6-8 the SSE2 ones and 9-11 the word-at-a-time ones the
+ *        shell used before, called directly.
+ * @s: The string; its last byte is the one _strchr looks for.
+ * @t: A copy of @s, for the comparisons.
+ *
+ * The empty asm makes the compiler assume the strings may change, so the
+ * libc calls, which it knows to be pure, are not hoisted out.
+ *
+ * Return: The nanoseconds per call.
+ */
+static double run(int what, char *s, char *t)
+{
+	long i, start = now_ns();
+	char c = s[strlen(s) - 1];
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		__asm__ __volatile__("" : : : "memory"); /* no hoisting */
+		switch (what)
+		{
+		case 0: sink += _strlen(s); break;
+		case 1: sink += (size_t)_strchr(s, c); break;
+		case 2: sink += _strcmp(s, t); break;
+		case 3: sink += strlen(s); break;
+		case 4: sink += (size_t)strchr(s, c); break;
+		case 5: sink += strcmp(s, t); break;
+		case 6: sink += str_sse2_len(s); break;
+		case 7: sink += (size_t)str_sse2_chr(s, c); break;
+		case 8: sink += str_sse2_same(s, t); break;
+		case 9: sink += str_word_len(s); break;
+		case 10: sink += (size_t)str_word_chr(s, c); break;
+		default: sink += str_word_same(s, t); break;
+		}
+	}
+	return ((double)(now_ns() - start) / ROUNDS);
+}
+
+/**
+ * main - Compares the shell's string scanning with libc's.
+ *
+ * Build from the top of the tree and run:
+ *   cc -O2 -o strbench bench/strings.c champ.c ax_it.c str_word.c \
+ *     str_sse2.c str_avx2.c && ./strbench
+ * The hsh column is what the shell calls: AVX2 where the CPU has it,
+ * picked once at startup. The word column is the scalar baseline, a
+ * word at a time, which is what other CPUs still get.
+ * This needs x86-64.
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	static char s[4096 + 1], t[4096 + 1];
+	static const char *name[] = {"strlen", "strchr", "strcmp"};
+	int lens[] = {7, 31, 100, 1000, 4000}, i, f;
+
+	printf("hsh scans with %s\n", str_len == str_avx2_len ? "AVX2" : "SSE2");
+	printf("ns per call%16s%8s%8s%8s\n", "hsh", "sse2", "word", "libc");
+	for (i = 0; i < (int)(sizeof(lens) / sizeof(*lens)); i++)
+	{
+		memset(s, 'x', lens[i]), s[lens[i]] = 0, s[lens[i] - 1] = 'y';
+		memcpy(t, s, lens[i] + 1);
+		for (f = 0; f < 3; f++)
+			printf("%-7s %4d bytes%10.1f%8.1f%8.1f%8.1f\n",
+					name[f], lens[i], run(f, s + 1, t + 1),
+					run(6 + f, s + 1, t + 1),
+					run(9 + f, s + 1, t + 1),
+					run(3 + f, s + 1, t + 1));
+	}
+	return (0);
+}
@@ -89,6 +89,27 @@ int _mycd(info_t *info)
 	return (0);
 }
 
+/**
+ * _mypwd - Prints the current working directory.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Return: 0 on success, 1 if the directory cannot be determined.
+ */
+int _mypwd(info_t *info)
+{
+	char buf[PATH_MAX];
+
+	if (!getcwd(buf, sizeof(buf)))
+	{
+		print_error(info, "cannot get current directory\n");
+		return (info->status = 1);
+	}
+	_puts(buf);
+	_putchar('\n');
+	return (info->status = 0);
+}
+
 /**
  * _myhelp - Change the working directory of the process.
  *
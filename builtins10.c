@@ -0,0 +1,190 @@
+/*
+ * File_name: builtins10.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * dag_done - Records that a task has finished, or will never run.
+ *
+ * @d: The run.
+ * @t: The task.
+ * @st: Its exit status, or -1 if it is skipped.
+ *
+ * A task that ran gets its run time and the longest chain of run times
+ * through its dependencies. Either way the tasks depending on it have
+ * one dependency less to wait for.
+ */
+static void dag_done(dag_t *d, int t, int st)
+{
+	task_t *task = &(d->task[t]), *dep, *u;
+	int i, j;
+
+	task->state = st == -1 ? TASK_SKIP : st ? TASK_FAIL : TASK_OK;
+	if (st != -1)
+	{
+		task->took = dag_now() - task->start;
+		d->failed += st != 0;
+		for (j = 0; j < task->ndep; j++)
+		{
+			dep = &(d->task[task->dep[j]]);
+			if (task->via != -1 && dep->path <= task->path)
+				continue;
+			task->path = dep->path, task->via = task->dep[j];
+		}
+		task->path += task->took;
+	}
+	for (i = 0; i < d->n; i++)
+		for (u = &(d->task[i]), j = 0; j < u->ndep; j++)
+			u->waiting -= u->dep[j] == t;
+}
+
+/**
+ * dag_next - Finds a task that is ready to run.
+ *
+ * @d: The run.
+ *
+ * A task whose dependencies have all finished but not all succeeded is
+ * skipped on the way, which may make more tasks ready.
+ *
+ * Return: The task's index, or -1 if none is ready.
+ */
+static int dag_next(dag_t *d)
+{
+	task_t *task;
+	int i, j;
+
+	for (i = 0; i < d->n; i++)
+	{
+		task = &(d->task[i]);
+		if (task->state != TASK_WAIT || task->waiting)
+			continue;
+		for (j = 0; j < task->ndep
+				&& d->task[task->dep[j]].state == TASK_OK; j++)
+			;
+		if (j == task->ndep)
+			return (i);
+		dag_done(d, i, -1);
+		i = -1;
+	}
+	return (-1);
+}
+
+/**
+ * dag_start - Starts a task's command.
+ *
+ * @info: The parameter struct.
+ * @d: The run; the pool must have a free slot.
+ * @t: The task.
+ *
+ * As make does, a command that is plain words is split in place and
+ * spawned straight from the shell; one with any shell syntax, or of
+ * more than one line, is handed to sh -c. A task with no command, or
+ * whose command cannot be started, is finished at once.
+ */
+static void dag_start(info_t *info, dag_t *d, int t)
+{
+	task_t *task = &(d->task[t]);
+	char *sh[4], **av = sh, *p;
+
+	task->state = TASK_RUN, task->start = dag_now();
+	for (p = task->cmd; p && *p && !_strchr(DAG_META, *p); p++)
+		;
+	if (!task->cmd)
+	{
+		dag_done(d, t, 0);
+		return;
+	}
+	if (*p)
+		sh[0] = "sh", sh[1] = "-c", sh[2] = task->cmd, sh[3] = NULL;
+	else
+	{
+		av = arena_alloc(&(info->arena), sizeof(char *)
+				* (split_words(task->cmd, NULL) + 1));
+		if (av)
+			split_words(task->cmd, av);
+	}
+	if (!av || pool_start(info, &(d->pool), av, t))
+		dag_done(d, t, av ? info->status : 1);
+}
+
+/**
+ * dag_run - Runs the tasks, at most pool.max at a time.
+ *
+ * @info: The parameter struct.
+ * @d: The run, with its tasks linked and its pool set up.
+ *
+ * Once a task fails no more are started, unless d->keep is set; the
+ * running ones are waited for either way.
+ */
+static void dag_run(info_t *info, dag_t *d)
+{
+	int t, st;
+
+	while (1)
+	{
+		t = -1;
+		if ((!d->failed || d->keep) && d->pool.running < d->pool.max)
+			t = dag_next(d);
+		if (t != -1)
+		{
+			dag_start(info, d, t);
+			continue;
+		}
+		if (!d->pool.running)
+			break;
+		t = pool_wait(info, &(d->pool), &st);
+		if (t == -1)
+			break;
+		dag_done(d, t, st);
+	}
+}
+
+/**
+ * _mydag - Runs a graph of tasks, each once those it needs are done.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Usage: dag [-j N] [-k] [file]
+ * The tasks are read from the file, or stdin, in the format dag_parse()
+ * describes. Up to N run at once (default: one per online CPU). A
+ * failure stops further tasks from starting, or with -k only those
+ * that depend on it. A summary with the critical path goes to stderr.
+ *
+ * Return: The number of tasks that failed, at most 100, or 2 on a usage
+ *         error or a bad task file.
+ */
+int _mydag(info_t *info)
+{
+	dag_t d;
+	char **av = info->argv + 1, *buf = NULL, **lines;
+	long jobs = 0, wall = dag_now();
+	int n = 0, fd = -1, bad;
+
+	_memset((char *)&d, 0, sizeof(d));
+	for (; *av && **av == '-' && (*av)[1] && jobs >= 0; av++)
+		if (!_strcmp(*av, "-k"))
+			d.keep = 1;
+		else if (_strcmp(*av, "-j") || !av[1] || _atol(*++av, &jobs))
+			jobs = -1;
+	if (jobs < 0 || jobs > INT_MAX || (*av && av[1]))
+		return (print_error(info, "usage: dag [-j N] [-k] [file]\n"),
+				info->status = 2);
+	if (*av && _strcmp(*av, "-"))
+		fd = open(*av, O_RDONLY | O_CLOEXEC);
+	if (*av && _strcmp(*av, "-") && fd == -1)
+		return (print_error(info, "cannot open "), _eputs(*av),
+				_eputs(": "), _eputs(strerror(errno)),
+				_eputchar('\n'), info->status = 2);
+	lines = read_items(info, fd, &n, &buf);
+	if (fd != -1)
+		close(fd);
+	bad = !lines || dag_parse(info, &d, lines, n)
+		|| pool_init(info, &(d.pool), jobs, d.n);
+	if (!bad)
+		dag_run(info, &d), dag_summary(&d, dag_now() - wall);
+	free(lines), free(buf);
+	return (info->status = bad ? 2 : d.failed > 100 ? 100 : d.failed);
+}
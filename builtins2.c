@@ -10,15 +10,42 @@
  * _myhistory - Display command history with line numbers.
  *
  * This function prints the command history stored in 'info' as a list of
- * commands, each preceded by a line number starting at 0.
+ * commands, each preceded by a line number starting at 0. With a numeric
+ * argument N, only the last N commands are printed; with -a, the lines
+ * not yet saved are appended to the history file instead.
  *
  * @info: Structure containing the command history and other information.
  *
- * Return: Always returns 0 to indicate successful execution.
+ * Return: 0 on success, 1 on a bad argument.
  */
 int _myhistory(info_t *info)
 {
-	print_list(info->history);
+	int i = 0, num;
+	char *line;
+
+	hist_load(info);
+	if (info->argv[1] && !_strcmp(info->argv[1], "-a"))
+		return (info->status = write_history(info) == -1);
+	if (info->argv[1])
+	{
+		i = _erratoi(info->argv[1]);
+		if (i == -1)
+		{
+			print_error(info, "numeric argument required\n");
+			return (info->status = 1);
+		}
+		i = info->history.count - i;
+		if (i < 0)
+			i = 0;
+	}
+	for (; (line = hist_at(info, i, &num)); i++)
+	{
+		_puts(convert_number(num, 10, 0));
+		_putchar(':');
+		_putchar(' ');
+		_puts(line);
+		_puts("\n");
+	}
 	return (0);
 }
 
@@ -90,8 +117,8 @@ int print_alias(list_t *node)
 	if (node)
 	{
 		p = _strchr(node->str, '=');
-		for (a = node->str; a <= p; a++)
-		_putchar(*a);
+		a = node->str;
+		w_write(STDOUT_FILENO, a, p - a + 1);
 		_putchar('\'');
 		_puts(p + 1);
 		_puts("'\n");
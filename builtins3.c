@@ -0,0 +1,189 @@
+/*
+ * File_name: builtins3.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * hash_list - Prints the remembered command locations.
+ *
+ * @info: The info struct holding the command hash.
+ * @all: If set, print every entry (misses included) as
+ *       "hits<TAB>name<TAB>path"; otherwise print the found commands
+ *       in the "hits<TAB>command" table of sh's hash.
+ *
+ * Return: Always 0.
+ */
+static int hash_list(info_t *info, int all)
+{
+	cmdhash_t *entry;
+	int i, n = 0;
+
+	for (i = 0; info->cmd_hash && i < CMD_HASH_SIZE; i++)
+		for (entry = info->cmd_hash[i]; entry; entry = entry->next)
+		{
+			if (!all && !entry->path)
+				continue;
+			if (!all && !n)
+				_puts("hits\tcommand\n");
+			n++;
+			_puts(convert_number(entry->hits, 10, 0));
+			_putchar('\t');
+			if (all)
+			{
+				_puts(entry->name);
+				_putchar('\t');
+			}
+			_puts(entry->path ? entry->path : "(not found)");
+			_putchar('\n');
+		}
+	if (!n && !all)
+		_puts("hash: hash table empty\n");
+	return (0);
+}
+
+/**
+ * _myhash - Inspects and edits the remembered command locations.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Usage: hash [-l] | hash -r | hash -d name... | hash -p path name |
+ *        hash name...
+ *
+ * Return: 0 on success, 1 if a name could not be found.
+ */
+int _myhash(info_t *info)
+{
+	int i = 1, ret = 0, drop = 0;
+	char *opt = info->argv[1];
+
+	if (!opt || !_strcmp(opt, "-l"))
+		return (info->status = hash_list(info, opt != NULL));
+	if (!_strcmp(opt, "-r"))
+	{
+		hash_drop(info, NULL);
+		return (info->status = 0);
+	}
+	if (!_strcmp(opt, "-p"))
+	{
+		if (info->argc == 4
+				&& hash_add(info, info->argv[3], info->argv[2]))
+			return (info->status = 0);
+		print_error(info, "-p: usage: hash -p path name\n");
+		return (info->status = 1);
+	}
+	if (!_strcmp(opt, "-d"))
+		drop = i++;
+	for (; info->argv[i]; i++)
+	{
+		if (drop ? hash_drop(info, info->argv[i])
+				: (builtin_lookup(info->argv[i])
+				|| locate_cmd(info, info->argv[i])))
+			continue;
+		print_error(info, info->argv[i]);
+		_eputs(": not found\n");
+		ret = 1;
+	}
+	return (info->status = ret);
+}
+
+/**
+ * type_of - Describes how the shell would run a command name.
+ *
+ * @info: Structure containing potential arguments.
+ * @name: The command name to describe.
+ * @verbose: If set, describe it in words as type does; otherwise print
+ *           only what command -v prints.
+ *
+ * Return: 0 if @name is known, 1 otherwise.
+ */
+static int type_of(info_t *info, char *name, int verbose)
+{
+	list_t *node = node_starts_with(info->alias, name, '=');
+	cmdhash_t *entry = NULL;
+	char *path;
+
+	if (node && !verbose)
+		return (_puts("alias "), print_alias(node));
+	if (node)
+	{
+		_puts(name), _puts(" is aliased to `");
+		_puts(_strchr(node->str, '=') + 1), _puts("'\n");
+		return (0);
+	}
+	if (builtin_lookup(name))
+	{
+		_puts(name);
+		_puts(verbose ? " is a shell builtin\n" : "\n");
+		return (0);
+	}
+	path = _getenv(info, "PATH=");
+	if (!_strchr(name, '/') && path_mtime(path, NULL) >= 0)
+		entry = hash_find(info, name);
+	path = entry ? entry->path : locate_cmd(info, name);
+	if (!path && _strchr(name, '/') && is_cmd(info, name))
+		path = name;
+	if (!path)
+	{
+		if (verbose)
+			print_error(info, name), _eputs(": not found\n");
+		return (1);
+	}
+	if (verbose)
+		_puts(name), _puts(entry ? " is hashed (" : " is ");
+	_puts(path);
+	_puts(entry && verbose ? ")\n" : "\n");
+	return (0);
+}
+
+/**
+ * _mytype - Tells how each name would be interpreted as a command.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Return: 0 if every name is known, 1 otherwise.
+ */
+int _mytype(info_t *info)
+{
+	int i, ret = 0;
+
+	for (i = 1; info->argv[i]; i++)
+		ret |= type_of(info, info->argv[i], 1);
+	return (info->status = ret);
+}
+
+/**
+ * _mycommand - Runs a command bypassing aliases, or describes it.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Usage: command [-v | -V] name... | command name [args...]
+ *
+ * Return: The built-in's return value when running one, else 0 or 1.
+ */
+int _mycommand(info_t *info)
+{
+	int i, ret = 0, verbose;
+	builtin_table *builtin;
+
+	if (info->argc == 1)
+		return (0);
+	if (!_strcmp(info->argv[1], "-v") || !_strcmp(info->argv[1], "-V"))
+	{
+		verbose = info->argv[1][1] == 'V';
+		for (i = 2; info->argv[i]; i++)
+			ret |= type_of(info, info->argv[i], verbose);
+		return (info->status = ret);
+	}
+	for (i = 0; i < info->argc; i++)
+		info->argv[i] = info->argv[i + 1];
+	info->argc--;
+	builtin = builtin_lookup(info->argv[0]);
+	if (builtin)
+		return (builtin->func(info));
+	info->linecount_flag = 0;
+	find_cmd(info);
+	return (0);
+}
@@ -0,0 +1,136 @@
+/*
+ * File_name: builtins4.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * read_escape - Decodes one backslash escape sequence.
+ *
+ * @s: The text just after the backslash.
+ * @c: Where the decoded character is stored.
+ *
+ * Knows \\ \a \b \e \f \n \r \t \v, up to three octal digits (with or
+ * without a leading 0, as echo and printf write them) and \c. Anything
+ * else stands for the backslash itself.
+ *
+ * Return: The text after the sequence, or NULL for \c, which ends all
+ *         output.
+ */
+char *read_escape(char *s, char *c)
+{
+	static char from[] = "\\abefnrtv", to[] = "\\\a\b\033\f\n\r\t\v";
+	char *p = *s ? _strchr(from, *s) : NULL;
+	int n = 0, i;
+
+	if (*s == 'c')
+		return (NULL);
+	if (p)
+		return (*c = to[p - from], s + 1);
+	if (*s < '0' || *s > '7')
+		return (*c = '\\', s);
+	if (*s == '0')
+		s++;
+	for (i = 0; i < 3 && *s >= '0' && *s <= '7'; i++)
+		n = n * 8 + (*s++ - '0');
+	*c = n;
+	return (s);
+}
+
+/**
+ * put_escaped - Writes a string to stdout, decoding backslash escapes.
+ *
+ * @s: The string.
+ * @stop: A character to stop at, besides the end of @s.
+ *
+ * Plain stretches between escapes are written in one piece.
+ *
+ * Return: Pointer to where writing stopped, or NULL if a \c was met.
+ */
+char *put_escaped(char *s, char stop)
+{
+	char *p, c;
+
+	for (p = s; *p && *p != stop;)
+	{
+		if (*p != '\\')
+		{
+			p++;
+			continue;
+		}
+		w_write(STDOUT_FILENO, s, p - s);
+		s = p = read_escape(p + 1, &c);
+		if (!p)
+			return (NULL);
+		w_write(STDOUT_FILENO, &c, 1);
+	}
+	w_write(STDOUT_FILENO, s, p - s);
+	return (p);
+}
+
+/**
+ * _myecho - Writes its arguments, separated by spaces, to stdout.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Usage: echo [-neE] [arg...]; -n drops the newline, -e turns on the
+ * backslash escapes of read_escape() and -E turns them back off.
+ *
+ * Return: Always 0.
+ */
+int _myecho(info_t *info)
+{
+	int i = 1, j, nl = 1, esc = 0;
+	char *a;
+
+	for (; (a = info->argv[i]) && a[0] == '-' && a[1]; i++)
+	{
+		for (j = 1; a[j] == 'n' || a[j] == 'e' || a[j] == 'E'; j++)
+			;
+		if (a[j])
+			break;
+		for (j = 1; a[j]; j++)
+			if (a[j] == 'n')
+				nl = 0;
+			else
+				esc = a[j] == 'e';
+	}
+	for (; (a = info->argv[i]); i++)
+	{
+		if (!esc)
+			_puts(a);
+		else if (!put_escaped(a, '\0'))
+			return (info->status = 0);
+		if (info->argv[i + 1])
+			_putchar(' ');
+	}
+	if (nl)
+		_putchar('\n');
+	return (info->status = 0);
+}
+
+/**
+ * _mytrue - Does nothing, successfully.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Return: Always 0.
+ */
+int _mytrue(info_t *info)
+{
+	return (info->status = 0);
+}
+
+/**
+ * _myfalse - Does nothing, unsuccessfully.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Return: Always 1.
+ */
+int _myfalse(info_t *info)
+{
+	return (info->status = 1);
+}
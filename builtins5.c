@@ -0,0 +1,199 @@
+/*
+ * File_name: builtins5.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * printf_pad - Writes a converted value padded to a field width.
+ *
+ * @s: The converted value.
+ * @len: How many bytes of @s to write.
+ * @width: The minimum field width.
+ * @flags: PF_LEFT to pad on the right, PF_ZERO to pad numbers with 0s
+ *         after their sign.
+ */
+static void printf_pad(char *s, size_t len, int width, int flags)
+{
+	char fill = flags & PF_ZERO ? '0' : ' ';
+	int pad = width > (int)len ? width - (int)len : 0;
+
+	if (!(flags & PF_LEFT))
+	{
+		if (fill == '0' && len && *s == '-')
+			w_write(STDOUT_FILENO, s++, 1), len--;
+		for (; pad; pad--)
+			w_write(STDOUT_FILENO, &fill, 1);
+	}
+	w_write(STDOUT_FILENO, s, len);
+	for (; pad; pad--)
+		w_write(STDOUT_FILENO, " ", 1);
+}
+
+/**
+ * printf_arg - Carries out one % conversion of a printf format.
+ *
+ * @info: Structure containing potential arguments.
+ * @p: The format just after the '%'.
+ * @a: Index of the next unused argument; advanced if one is used.
+ *
+ * Handles the -, 0, width and precision parts and the conversions
+ * %s %b %c %d %i %u %o %x %X and %%. A missing argument counts as an
+ * empty string or 0; a bad number is reported and counts as 0.
+ *
+ * Return: The format after the conversion, or NULL to stop printing.
+ */
+static char *printf_arg(info_t *info, char *p, int *a)
+{
+	int flags = 0, width = 0, prec = -1, len, base, cflags = 0;
+	char *arg;
+	long n = 0;
+
+	for (; *p == '-' || *p == '0'; p++)
+		flags |= *p == '-' ? PF_LEFT : PF_ZERO;
+	for (; *p >= '0' && *p <= '9'; p++)
+		width = width * 10 + (*p - '0');
+	if (*p == '.')
+		for (prec = 0, p++; *p >= '0' && *p <= '9'; p++)
+			prec = prec * 10 + (*p - '0');
+	if (*p == '%')
+		return (printf_pad("%", 1, 0, 0), p + 1);
+	if (!*p || !_strchr("sbcdiuoxX", *p))
+	{
+		print_error(info, "invalid directive\n");
+		info->status = 1;
+		return (NULL);
+	}
+	arg = info->argv[*a] ? info->argv[(*a)++] : "";
+	if (*p == 'b')
+		return (put_escaped(arg, '\0') ? p + 1 : NULL);
+	if (*p == 's' || *p == 'c')
+	{
+		len = *p == 'c' ? *arg != '\0' : _strlen(arg);
+		printf_pad(arg, prec >= 0 && prec < len ? prec : len, width,
+				flags & PF_LEFT);
+		return (p + 1);
+	}
+	if (*arg && _atol(arg, &n))
+		print_error(info, arg), _eputs(": invalid number\n"),
+			info->status = 1;
+	base = *p == 'o' ? 8 : (*p == 'x' || *p == 'X' ? 16 : 10);
+	if (*p == 'x')
+		cflags |= CONVERT_LOWERCASE;
+	if (*p != 'd' && *p != 'i')
+		cflags |= CONVERT_UNSIGNED;
+	arg = convert_number(n, base, cflags);
+	printf_pad(arg, _strlen(arg), width, flags);
+	return (p + 1);
+}
+
+/**
+ * _myprintf - Writes its arguments under the control of a format.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Usage: printf format [argument...]; the format is reused for as long
+ * as it keeps consuming arguments, as POSIX asks.
+ *
+ * Return: 0 on success, 1 if an argument was bad, 2 on a usage error.
+ */
+int _myprintf(info_t *info)
+{
+	int a = 2, used;
+	char *p;
+
+	if (!info->argv[1])
+	{
+		print_error(info, "usage: printf format [arguments]\n");
+		return (info->status = 2);
+	}
+	info->status = 0;
+	do {
+		used = a;
+		p = info->argv[1];
+		while (p && *p)
+		{
+			p = put_escaped(p, '%');
+			if (p && *p)
+				p = printf_arg(info, p + 1, &a);
+		}
+	} while (p && a > used && info->argv[a]);
+	return (info->status);
+}
+
+/**
+ * sleep_ns - Parses a sleep interval.
+ *
+ * @s: A decimal number of seconds with an optional fraction and an
+ *     optional s, m, h or d suffix, such as "0.1" or "2m".
+ *
+ * Return: The interval in nanoseconds, or ULONG_MAX if @s is invalid.
+ */
+static unsigned long sleep_ns(char *s)
+{
+	static const unsigned long mul[] = {1, 60, 3600, 86400};
+	unsigned long sec = 0, ns = 0, scale = 100000000;
+	char units[] = "smhd", *unit = units;
+	int digits = 0;
+
+	for (; *s >= '0' && *s <= '9'; s++, digits++)
+		sec = sec * 10 + (*s - '0');
+	if (*s == '.')
+		for (s++; *s >= '0' && *s <= '9'; s++, digits++, scale /= 10)
+			ns += (*s - '0') * scale;
+	if (*s)
+		unit = s[1] ? NULL : _strchr(units, *s);
+	if (!digits || !unit || sec > 1000000 / mul[unit - units])
+		return (ULONG_MAX);
+	return ((sec * 1000000000 + ns) * mul[unit - units]);
+}
+
+/**
+ * _mysleep - Suspends the shell for the sum of its intervals.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * The wait is a single sigtimedwait() for SIGINT in the shell itself,
+ * so a background job finishing does not cut it short but ^C does,
+ * even though ev_init() keeps SIGINT blocked. Output still buffered is
+ * flushed first.
+ *
+ * Return: 0 on success, 1 on a bad interval, 130 if interrupted.
+ */
+int _mysleep(info_t *info)
+{
+	unsigned long total = 0, ns;
+	struct timespec ts;
+	sigset_t intr;
+	int i, r;
+
+	if (!info->argv[1])
+	{
+		print_error(info, "missing operand\n");
+		return (info->status = 1);
+	}
+	for (i = 1; info->argv[i]; i++)
+	{
+		ns = sleep_ns(info->argv[i]);
+		if (ns == ULONG_MAX)
+		{
+			print_error(info, "invalid time interval '");
+			_eputs(info->argv[i]);
+			_eputs("'\n");
+			return (info->status = 1);
+		}
+		total += ns;
+	}
+	w_flush(-1);
+	ts.tv_sec = total / 1000000000;
+	ts.tv_nsec = total % 1000000000;
+	sigemptyset(&intr);
+	sigaddset(&intr, SIGINT);
+	r = sigtimedwait(&intr, NULL, &ts);
+	r = r == SIGINT || (r == -1 && errno == EINTR); /* EINTR: handler ran */
+	if (r && interactive(info))
+		_putchar('\n');
+	return (info->status = r ? 130 : 0);
+}
@@ -0,0 +1,161 @@
+/*
+ * File_name: builtins6.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * test_unary - Evaluates a unary test primary.
+ *
+ * @op: The operator, such as "-f" or "-z".
+ * @arg: Its operand.
+ *
+ * Return: 0 if true, 1 if false, 2 if @op is not a unary operator.
+ */
+static int test_unary(char *op, char *arg)
+{
+	static const char types[] = "fdbcpSLh";
+	static const mode_t modes[] = {S_IFREG, S_IFDIR, S_IFBLK, S_IFCHR,
+		S_IFIFO, S_IFSOCK, S_IFLNK, S_IFLNK};
+	char *type = _strchr((char *)types, op[1]);
+	struct stat st;
+	long fd;
+
+	if (op[0] != '-' || !op[1] || op[2])
+		return (2);
+	if (!_strchr("nzterwxsfdbcpSLh", op[1]))
+		return (2);
+	if (op[1] == 'n' || op[1] == 'z')
+		return ((op[1] == 'n') == !*arg);
+	if (op[1] == 't')
+		return (_atol(arg, &fd) || fd < 0 || fd > INT_MAX
+				|| !isatty(fd));
+	if (op[1] == 'r' || op[1] == 'w' || op[1] == 'x')
+		return (access(arg, op[1] == 'r' ? R_OK : op[1] == 'w' ? W_OK
+					: X_OK) != 0);
+	if (op[1] == 'L' || op[1] == 'h' ? lstat(arg, &st) : stat(arg, &st))
+		return (1);
+	if (op[1] == 's')
+		return (st.st_size < 1);
+	if (type)
+		return ((st.st_mode & S_IFMT) != modes[type - types]);
+	return (0);
+}
+
+/**
+ * test_binary - Evaluates a binary test primary.
+ *
+ * @info: Structure containing potential arguments.
+ * @a: The left operand.
+ * @op: The operator: =, ==, !=, -eq, -ne, -lt, -le, -gt or -ge.
+ * @b: The right operand.
+ *
+ * Return: 0 if true, 1 if false, 2 if an integer operand is bad, or -1
+ *         if @op is not a binary operator.
+ */
+static int test_binary(info_t *info, char *a, char *op, char *b)
+{
+	static char *ops[] = {"-eq", "-ne", "-lt", "-le", "-gt", "-ge", NULL};
+	long x, y;
+	int i;
+
+	if (!_strcmp(op, "=") || !_strcmp(op, "=="))
+		return (_strcmp(a, b) != 0);
+	if (!_strcmp(op, "!="))
+		return (!_strcmp(a, b));
+	for (i = 0; ops[i] && _strcmp(op, ops[i]); i++)
+		;
+	if (!ops[i])
+		return (-1);
+	if (_atol(a, &x) || _atol(b, &y))
+	{
+		print_error(info, _atol(a, &x) ? a : b);
+		_eputs(": integer expression expected\n");
+		return (2);
+	}
+	if (i < 2)
+		return ((x == y) == i);
+	if (i < 4)
+		return (!(x < y || (i == 3 && x == y)));
+	return (!(x > y || (i == 5 && x == y)));
+}
+
+/**
+ * test_eval - Evaluates a test expression by its number of arguments.
+ *
+ * @info: Structure containing potential arguments.
+ * @av: The arguments.
+ * @n: How many there are.
+ *
+ * Follows the POSIX rules for up to four arguments: a lone string is
+ * true when not empty, a leading ! negates the rest, and parentheses
+ * may wrap one or two arguments.
+ *
+ * Return: 0 if true, 1 if false, 2 on error.
+ */
+static int test_eval(info_t *info, char **av, int n)
+{
+	int r = -1;
+
+	if (n == 0)
+		return (1);
+	if (n == 1)
+		return (!*av[0]);
+	if (n == 3)
+		r = test_binary(info, av[0], av[1], av[2]);
+	if (r != -1)
+		return (r);
+	if (!_strcmp(av[0], "!"))
+	{
+		r = test_eval(info, av + 1, n - 1);
+		return (r == 2 ? 2 : !r);
+	}
+	if (n > 4)
+		return (print_error(info, "too many arguments\n"), 2);
+	if (n > 2 && !_strcmp(av[0], "(") && !_strcmp(av[n - 1], ")"))
+		return (test_eval(info, av + 1, n - 2));
+	if (n == 2)
+		r = test_unary(av[0], av[1]);
+	if (r == 2 || r == -1)
+	{
+		print_error(info, n == 2 ? av[0] : av[1]);
+		_eputs(n == 2 ? ": unary operator expected\n"
+				: ": binary operator expected\n");
+		return (2);
+	}
+	return (r);
+}
+
+/**
+ * _mytest - Evaluates a conditional expression.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Usage: test expression; see test_eval() for what is understood.
+ *
+ * Return: 0 if the expression is true, 1 if false, 2 on error.
+ */
+int _mytest(info_t *info)
+{
+	return (info->status = test_eval(info, info->argv + 1, info->argc - 1));
+}
+
+/**
+ * _mybracket - The [ spelling of test, which must end with ].
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Return: 0 if the expression is true, 1 if false, 2 on error.
+ */
+int _mybracket(info_t *info)
+{
+	if (info->argc < 2 || _strcmp(info->argv[info->argc - 1], "]"))
+	{
+		print_error(info, "missing ]\n");
+		return (info->status = 2);
+	}
+	info->argv[--info->argc] = NULL;
+	return (_mytest(info));
+}
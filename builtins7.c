@@ -0,0 +1,149 @@
+/*
+ * File_name: builtins7.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * jobs_report - Lists background jobs, forgetting the finished ones.
+ *
+ * @info: The parameter struct holding the job table.
+ * @all: 1 to list every job, 0 to list only those that have finished.
+ *
+ * Each job is shown as [n], its state (Running, Done, or Exit and the
+ * status of its last stage) and its command.
+ */
+void jobs_report(info_t *info, int all)
+{
+	job_t *job, *next;
+
+	for (job = info->jobs; job; job = next)
+	{
+		next = job->next;
+		if (!all && job->live)
+			continue;
+		_putchar('['), print_d(job->id, STDOUT_FILENO), _puts("]  ");
+		if (job->live)
+			_puts("Running");
+		else if (!job->status)
+			_puts("Done");
+		else
+			_puts("Exit "), print_d(job->status, STDOUT_FILENO);
+		_puts("\t");
+		_puts(job->cmd ? job->cmd : "");
+		_putchar('\n');
+		if (!job->live)
+			job_drop(info, job);
+	}
+}
+
+/**
+ * job_drop - Removes a job from the table.
+ *
+ * @info: The parameter struct holding the job table.
+ * @job: The job.
+ */
+void job_drop(info_t *info, job_t *job)
+{
+	job_t **p;
+
+	for (p = &(info->jobs); *p && *p != job; p = &((*p)->next))
+		;
+	if (*p)
+		*p = job->next;
+	free(job->cmd);
+	free(job);
+}
+
+/**
+ * job_find - Looks up the job a wait operand names.
+ *
+ * @info: The parameter struct holding the job table.
+ * @arg: A pid, or %n for job number n; either must be above 0.
+ *
+ * Return: The job, or NULL if there is none (after reporting it).
+ */
+static job_t *job_find(info_t *info, char *arg)
+{
+	job_t *job;
+	long n;
+	int i = 0;
+
+	if (!_atol(arg + (*arg == '%'), &n) && n > 0) /* 0: never started */
+		for (job = info->jobs; job; job = job->next)
+		{
+			if (*arg == '%' && job->id == n)
+				return (job);
+			for (i = 0; *arg != '%' && i < job->n; i++)
+				if (job->pid[i] == n || job->pid[i] == -n)
+					return (job);
+		}
+	print_error(info, arg);
+	_eputs(*arg == '%' ? ": no such job\n"
+			: ": not a child of this shell\n");
+	return (NULL);
+}
+
+/**
+ * _myjobs - Lists the background jobs.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Finished jobs are listed once more and then forgotten.
+ *
+ * Return: Always 0.
+ */
+int _myjobs(info_t *info)
+{
+	jobs_reap(info, 0);
+	jobs_report(info, 1);
+	return (info->status = 0);
+}
+
+/**
+ * _mywait - Waits for background jobs to finish.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Usage: wait [-n] [pid|%n...]. With no operand every job is waited
+ * for; with -n, whichever finishes first (or has already finished).
+ * The jobs waited for are forgotten.
+ *
+ * Return: The status of the last job waited for, 0 with no operand, or
+ *         127 if a job is unknown (or -n has none to wait for).
+ */
+int _mywait(info_t *info)
+{
+	job_t *job;
+	int i = 1;
+
+	if (info->argv[1] && !_strcmp(info->argv[1], "-n"))
+	{
+		for (job = info->jobs; job && job->live; job = job->next)
+			;
+		if (!job)
+			job = jobs_reap(info, 1);
+		info->status = job ? job->status : 127;
+		if (job)
+			job_drop(info, job);
+		return (info->status);
+	}
+	info->status = 0;
+	for (; info->argv[i]; i++)
+	{
+		job = job_find(info, info->argv[i]);
+		while (job && job->live && jobs_reap(info, 1))
+			;
+		info->status = job && !job->live ? job->status : 127;
+		if (job)
+			job_drop(info, job);
+	}
+	while (i == 1 && info->jobs)
+		if (info->jobs->live && !jobs_reap(info, 1))
+			break;
+		else if (!info->jobs->live)
+			job_drop(info, info->jobs);
+	return (info->status);
+}
@@ -0,0 +1,181 @@
+/*
+ * File_name: builtins8.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * par_flush - Writes the kept output of finished items, in item order.
+ *
+ * @par: The run; output is written up to the first unfinished item.
+ */
+static void par_flush(par_t *par)
+{
+	char buf[WRITE_BUF_SIZE];
+	ssize_t r;
+	off_t off;
+	int fd;
+
+	while (par->next < par->n && par->done[par->next])
+	{
+		fd = par->out[par->next++];
+		if (fd == -1)
+			continue;
+		for (off = 0; (r = pread(fd, buf, sizeof(buf), off)) > 0;)
+			w_write(STDOUT_FILENO, buf, r), off += r;
+		close(fd);
+	}
+}
+
+/**
+ * par_start - Starts the command for the next item.
+ *
+ * @info: The parameter struct.
+ * @par: The run; the pool must have a free slot.
+ * @i: The item.
+ *
+ * Its stdout goes to a fresh memfd with --keep-order, and its stdin is
+ * /dev/null when the items were read from stdin. An item that cannot
+ * be started counts as finished and failed.
+ */
+static void par_start(info_t *info, par_t *par, int i)
+{
+	fdmap_t *fds = &(info->fds);
+	int base = fds->n;
+	char **av = item_argv(info, par->tmpl, par->item[i]);
+
+	par->out[i] = par->keep ? memfd_create("parallel", MFD_CLOEXEC) : -1;
+	if (!av || base > FDMAP_MAX - 2)
+	{
+		par->done[i] = 1, par->failed++;
+		return;
+	}
+	if (par->in != -1)
+		fds->fd[fds->n] = STDIN_FILENO, fds->own[fds->n] = 0,
+			fds->to[fds->n++] = par->in;
+	if (par->out[i] != -1)
+		fds->fd[fds->n] = STDOUT_FILENO, fds->own[fds->n] = 0,
+			fds->to[fds->n++] = par->out[i];
+	if (pool_start(info, &(par->pool), av, i))
+		par->done[i] = 1, par->failed++;
+	fds->n = base;
+}
+
+/**
+ * par_run - Runs every item, at most pool.max at a time.
+ *
+ * @info: The parameter struct.
+ * @par: The run, with its items and pool set up.
+ *
+ * With --keep-order no item is started more than 4 times the pool size
+ * ahead of the oldest one still unwritten, which bounds the number of
+ * memfds held open however slow that one is.
+ */
+static void par_run(info_t *info, par_t *par)
+{
+	int i = 0, t, st, window = par->pool.max * 4;
+
+	while (i < par->n || par->pool.running)
+	{
+		if (i < par->n && par->pool.running < par->pool.max
+				&& (!par->keep || i < par->next + window))
+		{
+			par_start(info, par, i++);
+			if (par->keep)
+				par_flush(par);
+			continue;
+		}
+		t = pool_wait(info, &(par->pool), &st);
+		if (t == -1)
+			break;
+		par->done[t] = 1;
+		par->failed += st != 0;
+		if (par->keep)
+			par_flush(par);
+	}
+}
+
+/**
+ * par_opts - Reads the options of parallel.
+ *
+ * @info: Structure containing potential arguments.
+ * @par: The run; its keep flag is set.
+ * @jobs: Where the -j count is stored, 0 if not given.
+ *
+ * Return: The command's first word, or NULL on a usage error (after
+ *         reporting it).
+ */
+static char **par_opts(info_t *info, par_t *par, long *jobs)
+{
+	char **av = info->argv + 1, *n = NULL;
+
+	for (; *av && **av == '-' && _strcmp(*av, "--"); av++)
+		if (!_strcmp(*av, "-k") || !_strcmp(*av, "--keep-order"))
+			par->keep = 1;
+		else if (!_strcmp(*av, "-j") && av[1])
+			n = *++av;
+		else if (!_strncmp(*av, "-j", 2) && (*av)[2])
+			n = *av + 2;
+		else
+			break;
+	av += *av && !_strcmp(*av, "--");
+	if ((n && (_atol(n, jobs) || *jobs < 0 || *jobs > INT_MAX)) || !*av
+			|| **av == '-' || !_strcmp(*av, ":::"))
+	{
+		print_error(info, "usage: parallel [-j N] [-k] command [arg...]"
+				" [::: item...]\n");
+		return (NULL);
+	}
+	return (av);
+}
+
+/**
+ * _myparallel - Runs a command once per item, several at a time.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Usage: parallel [-j N] [-k|--keep-order] command [arg...] [::: item...]
+ * Without ::: the items are the lines of stdin. At most N commands run
+ * at once (default: one per online CPU), each spawned by the shell
+ * itself. With -k each command's stdout is held until those of the
+ * items before it are written, so the output comes in item order.
+ *
+ * Return: The number of items that failed, at most 100, or 2 on a usage
+ *         error.
+ */
+int _myparallel(info_t *info)
+{
+	par_t par;
+	char **av, *buf = NULL, **items = NULL;
+	long jobs = 0;
+	int i;
+
+	_memset((char *)&par, 0, sizeof(par));
+	av = par_opts(info, &par, &jobs);
+	if (!av)
+		return (info->status = 2);
+	for (i = 0; av[i] && _strcmp(av[i], ":::"); i++)
+		;
+	par.tmpl = av, par.item = av + i + 1, par.n = 0, par.in = -1;
+	if (!av[i])
+		par.item = items = read_items(info, -1, &par.n, &buf),
+			par.in = open("/dev/null", O_RDONLY | O_CLOEXEC);
+	av[i] = NULL;
+	for (; par.item && par.item[par.n] && !items; par.n++)
+		;
+	par.out = arena_alloc(&(info->arena), sizeof(int) * (par.n + 1));
+	par.done = arena_alloc(&(info->arena), par.n + 1);
+	if (par.item && par.out && par.done
+			&& !pool_init(info, &(par.pool), jobs, par.n))
+	{
+		_memset(par.done, 0, par.n);
+		par_run(info, &par);
+		par_flush(&par);
+	}
+	if (par.in != -1)
+		close(par.in);
+	free(items), free(buf);
+	return (info->status = par.failed > 100 ? 100 : par.failed);
+}
@@ -0,0 +1,182 @@
+/*
+ * File_name: builtins9.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * batch_room - Works out how many bytes of items fit in a command line.
+ *
+ * @info: The parameter struct holding the environment.
+ * @b: The run; its tmpl and nt must be set.
+ *
+ * execve() takes at most ARG_MAX bytes of arguments and environment,
+ * counting each string with its '\0' and its pointer. What the
+ * environment and the command's own words take is left out, and so is
+ * BATCH_SLACK, as xargs does.
+ *
+ * Return: The bytes left for items.
+ */
+static long batch_room(info_t *info, batch_t *b)
+{
+	long room = sysconf(_SC_ARG_MAX);
+	char **env = get_environ(info);
+	int i;
+
+	if (room <= 0)
+		room = _POSIX_ARG_MAX;
+	room -= BATCH_SLACK + sizeof(char *);
+	for (; env && *env; env++)
+		room -= _strlen(*env) + 1 + sizeof(char *);
+	for (i = 0; i < b->nt; i++)
+		room -= _strlen(b->tmpl[i]) + 1 + sizeof(char *);
+	return (room);
+}
+
+/**
+ * batch_next - Builds the command line for the next batch of items.
+ *
+ * @info: The parameter struct whose arena holds the result.
+ * @b: The run; its next item is moved past those taken.
+ *
+ * As many items are taken as b->room and b->max allow, and always at
+ * least one. The argv is one allocation of pointers; the words are
+ * those of the command and the items where they already are.
+ *
+ * Return: The new argv, or NULL on allocation failure (the items are
+ *         skipped all the same).
+ */
+static char **batch_next(info_t *info, batch_t *b)
+{
+	long room = b->room;
+	char **av;
+	int k, i;
+
+	for (k = 0; b->next + k < b->n && (!b->max || k < b->max); k++)
+	{
+		room -= _strlen(b->item[b->next + k]) + 1 + sizeof(char *);
+		if (room < 0 && k)
+			break;
+	}
+	av = arena_alloc(&(info->arena), sizeof(char *) * (b->nt + k + 1));
+	if (!av)
+		return (b->next += k, NULL);
+	for (i = 0; i < b->nt; i++)
+		av[i] = b->tmpl[i];
+	for (i = 0; i < k; i++)
+		av[b->nt + i] = b->item[b->next++];
+	av[b->nt + k] = NULL;
+	return (av);
+}
+
+/**
+ * batch_start - Starts the command for the next batch of items.
+ *
+ * @info: The parameter struct.
+ * @b: The run; the pool must have a free slot.
+ *
+ * Its stdin is /dev/null when the items were read from stdin. A batch
+ * that cannot be started counts as failed.
+ */
+static void batch_start(info_t *info, batch_t *b)
+{
+	fdmap_t *fds = &(info->fds);
+	int base = fds->n;
+	char **av = batch_next(info, b);
+
+	if (!av || base > FDMAP_MAX - 1)
+	{
+		b->failed++;
+		return;
+	}
+	if (b->in != -1)
+		fds->fd[fds->n] = STDIN_FILENO, fds->own[fds->n] = 0,
+			fds->to[fds->n++] = b->in;
+	if (pool_start(info, &(b->pool), av, 0))
+		b->failed++;
+	fds->n = base;
+}
+
+/**
+ * batch_opts - Reads the options and command of batch.
+ *
+ * @info: Structure containing potential arguments.
+ * @b: The run; its max, tmpl and nt are set.
+ * @jobs: Where the -j count is stored, 1 if not given.
+ *
+ * Return: Where the command ends (its --, or the NULL ending argv), or
+ *         NULL on a usage error (after reporting it).
+ */
+static char **batch_opts(info_t *info, batch_t *b, long *jobs)
+{
+	char **av = info->argv + 1;
+	long n = 0;
+
+	for (*jobs = 1; *av && av[1] && (!_strcmp(*av, "-j")
+				|| !_strcmp(*av, "-n")); av += 2)
+		if (_atol(av[1], av[0][1] == 'j' ? jobs : &n) || n < 0
+				|| *jobs < 0 || *jobs > INT_MAX)
+			break;
+	b->max = n;
+	b->tmpl = av += *av && !_strcmp(*av, "--");
+	for (b->nt = 0; av[b->nt] && _strcmp(av[b->nt], "--"); b->nt++)
+		;
+	if (!b->nt || **av == '-')
+	{
+		print_error(info, "usage: batch [-j N] [-n N] command [arg...]"
+				" [-- item...]\n");
+		return (NULL);
+	}
+	return (av + b->nt);
+}
+
+/**
+ * _mybatch - Runs a command on many items, as few times as it can.
+ *
+ * @info: Structure containing potential arguments.
+ *
+ * Usage: batch [-j N] [-n N] command [arg...] [-- item...]
+ * The items (those after --, or else the lines of stdin) are added to
+ * the command, as many at a time as the kernel's ARG_MAX leaves room
+ * for beside the environment, or at most N with -n. Up to N commands
+ * run at once with -j (default 1, 0 for one per online CPU), each
+ * spawned by the shell itself. No item means no command.
+ *
+ * Return: The number of commands that failed, at most 100, or 2 on a
+ *         usage error.
+ */
+int _mybatch(info_t *info)
+{
+	batch_t b;
+	char **av, *buf = NULL, **items = NULL;
+	long jobs;
+	int st;
+
+	_memset((char *)&b, 0, sizeof(b));
+	av = batch_opts(info, &b, &jobs);
+	if (!av)
+		return (info->status = 2);
+	b.item = av + 1, b.in = -1, b.room = batch_room(info, &b);
+	if (!*av)
+		b.item = items = read_items(info, -1, &b.n, &buf),
+			b.in = open("/dev/null", O_RDONLY | O_CLOEXEC);
+	*av = NULL;
+	for (; b.item && b.item[b.n] && !items; b.n++)
+		;
+	if (b.item && !pool_init(info, &(b.pool), jobs, b.n))
+	{
+		while (b.next < b.n || b.pool.running)
+			if (b.next < b.n && b.pool.running < b.pool.max)
+				batch_start(info, &b);
+			else if (pool_wait(info, &(b.pool), &st) == -1)
+				break;
+			else
+				b.failed += st != 0;
+	}
+	if (b.in != -1)
+		close(b.in);
+	free(items), free(buf);
+	return (info->status = b.failed > 100 ? 100 : b.failed);
+}
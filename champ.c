@@ -12,19 +12,14 @@
  * @s: The string to measure.
  *
  * This function calculates and returns the length of the input string 's'.
+ * The scan is str_len(): SSE2 on x86-64, or AVX2 where the CPU has it,
+ * and elsewhere a word at a time.
  *
  * Return: The integer length of the string.
  */
 int _strlen(char *s)
 {
-	int i = 0;
-
-	if (!s)
-		return (0);
-
-	while (*s++)
-		i++;
-	return (i);
+	return (s ? str_len(s) : 0);
 }
 
 /**
@@ -38,21 +33,16 @@ int _strlen(char *s)
  *  - A positive value if @s1 comes after @s2 in lexicographic order.
  *  - Zero if @s1 and @s2 are equal.
  *
+ * The equal prefix is measured with str_same(), as wide as the CPU
+ * allows; the first byte past it decides.
+ *
  * Return: The result of the comparison.
  */
 int _strcmp(char *s1, char *s2)
 {
-	while (*s1 && *s2)
-	{
-		if (*s1 != *s2)
-			return (*s1 - *s2);
-		s1++;
-		s2++;
-	}
-	if (*s1 == *s2)
-		return (0);
-	else
-		return (*s1 < *s2 ? -1 : 1);
+	size_t n = str_same(s1, s2);
+
+	return (s1[n] - s2[n]);
 }
 
 /**
@@ -64,16 +54,15 @@ int _strcmp(char *s1, char *s2)
  * This function checks if the haystack string starts with the needle
  * substring. If a match is found, it returns the address of the next
  * character in the haystack after the needle. If no match is found,
- * it returns NULL.
+ * it returns NULL. The common prefix is measured with str_same().
  *
  * Return: Address of the next character after needle or NULL.
  */
 char *starts_with(const char *haystack, const char *needle)
 {
-	while (*needle)
-		if (*needle++ != *haystack++)
-			return (NULL);
-	return ((char *)haystack);
+	size_t n = str_same(needle, haystack);
+
+	return (needle[n] ? NULL : (char *)haystack + n);
 }
 
 /**
@@ -93,8 +82,7 @@ char *_strcat(char *dest, char *src)
 {
 	char *ret = dest;
 
-	while (*dest)
-		dest++;
+	dest += _strlen(dest);
 	while (*src)
 		*dest++ = *src++;
 	*dest = *src;
@@ -73,15 +73,8 @@ char *_strdup(const char *str)
  */
 void _puts(char *str)
 {
-	int i = 0;
-
-	if (!str)
-		return;
-	while (str[i] != '\0')
-	{
-		_putchar(str[i]);
-		i++;
-	}
+	if (str)
+		w_write(STDOUT_FILENO, str, _strlen(str));
 }
 
 /**
@@ -97,15 +90,7 @@ void _puts(char *str)
  */
 int _putchar(char c)
 {
-	static int i;
-	static char buf[WRITE_BUF_SIZE];
-
-	if (c == BUF_FLUSH || i >= WRITE_BUF_SIZE)
-	{
-		write(1, buf, i);
-		i = 0;
-	}
-	if (c != BUF_FLUSH)
-		buf[i++] = c;
-	return (1);
+	if (c == BUF_FLUSH)
+		return (w_flush(STDOUT_FILENO) ? -1 : 1);
+	return (w_write(STDOUT_FILENO, &c, 1));
 }
@@ -0,0 +1,170 @@
+/*
+ * File_name: cmd_hash.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * hash_index - Picks the bucket a command name belongs to.
+ *
+ * @name: The command name.
+ *
+ * Return: The bucket index, below CMD_HASH_SIZE.
+ */
+static unsigned int hash_index(char *name)
+{
+	unsigned long h = 5381;
+
+	while (*name)
+		h = h * 33 + (unsigned char)*name++;
+	return (h % CMD_HASH_SIZE);
+}
+
+/**
+ * hash_stamp - Reads the directory stamp an entry is validated against.
+ *
+ * @info: The info struct, for the PATH of negative entries.
+ * @path: The remembered full path, or NULL for a command not found.
+ * @ts: Where the stamp is stored.
+ *
+ * A found command is stamped with the modification time of the
+ * directory holding it; a miss with the newest time of any PATH
+ * directory, since the command may show up in any of them.
+ *
+ * Return: 0 on success, -1 if the stamp cannot be taken.
+ */
+int hash_stamp(info_t *info, char *path, struct timespec *ts)
+{
+	struct stat st;
+	char *slash;
+	int r;
+
+	if (!path)
+		return (path_mtime(_getenv(info, "PATH="), ts) < 0 ? -1 : 0);
+	slash = path + _strlen(path);
+	while (slash > path && *slash != '/')
+		slash--;
+	if (*slash != '/')
+		return (stat(".", &st) ? -1 : (*ts = st.st_mtim, 0));
+	*slash = 0;
+	r = stat(*path ? path : "/", &st);
+	*slash = '/';
+	if (r)
+		return (-1);
+	*ts = st.st_mtim;
+	return (0);
+}
+
+/**
+ * hash_find - Looks a command up in the command hash.
+ *
+ * @info: The info struct holding the command hash.
+ * @name: The command name.
+ *
+ * An entry whose directory changed since it was made is stale: it is
+ * dropped and the lookup misses.
+ *
+ * Return: The entry (whose path is NULL for a remembered miss), or NULL.
+ */
+cmdhash_t *hash_find(info_t *info, char *name)
+{
+	cmdhash_t *entry;
+	struct timespec ts;
+
+	if (!info->cmd_hash)
+		return (NULL);
+	entry = info->cmd_hash[hash_index(name)];
+	while (entry && _strcmp(entry->name, name))
+		entry = entry->next;
+	if (!entry)
+		return (NULL);
+	if (!hash_stamp(info, entry->path, &ts) && TS_EQUAL(ts, entry->stamp))
+		return (entry);
+	hash_drop(info, name);
+	return (NULL);
+}
+
+/**
+ * hash_add - Remembers where a command lives.
+ *
+ * @info: The info struct holding the command hash.
+ * @name: The command name.
+ * @path: The full path of the command, or NULL if it was not found.
+ *
+ * Return: The new entry, or NULL on failure.
+ */
+cmdhash_t *hash_add(info_t *info, char *name, char *path)
+{
+	cmdhash_t *entry;
+	unsigned int i, size = sizeof(cmdhash_t *) * CMD_HASH_SIZE;
+
+	if (!info->cmd_hash)
+	{
+		info->cmd_hash = malloc(size);
+		if (!info->cmd_hash)
+			return (NULL);
+		_memset((void *)info->cmd_hash, 0, size);
+	}
+	hash_drop(info, name);
+	entry = malloc(sizeof(cmdhash_t));
+	if (!entry)
+		return (NULL);
+	_memset((void *)entry, 0, sizeof(cmdhash_t));
+	entry->name = _strdup(name);
+	entry->path = _strdup(path);
+	if (!entry->name || (path && !entry->path)
+			|| hash_stamp(info, entry->path, &entry->stamp))
+	{
+		free(entry->name);
+		free(entry->path);
+		free(entry);
+		return (NULL);
+	}
+	i = hash_index(name);
+	entry->next = info->cmd_hash[i];
+	info->cmd_hash[i] = entry;
+	return (entry);
+}
+
+/**
+ * hash_drop - Forgets one remembered command, or all of them.
+ *
+ * @info: The info struct holding the command hash.
+ * @name: The command to forget, or NULL to empty the whole hash.
+ *
+ * Return: The number of entries forgotten.
+ */
+int hash_drop(info_t *info, char *name)
+{
+	cmdhash_t **pp, *entry;
+	unsigned int i;
+	int n = 0;
+
+	if (!info->cmd_hash)
+		return (0);
+	for (i = name ? hash_index(name) : 0; i < CMD_HASH_SIZE; i++)
+	{
+		pp = &(info->cmd_hash[i]);
+		while (*pp)
+		{
+			entry = *pp;
+			if (name && _strcmp(entry->name, name))
+			{
+				pp = &(entry->next);
+				continue;
+			}
+			*pp = entry->next;
+			free(entry->name);
+			free(entry->path);
+			free(entry);
+			n++;
+		}
+		if (name)
+			return (n);
+	}
+	free(info->cmd_hash);
+	info->cmd_hash = NULL;
+	return (n);
+}
@@ -0,0 +1,188 @@
+/*
+ * File_name: dag.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * dag_now - Reads the monotonic clock.
+ *
+ * Return: The time in milliseconds, from an arbitrary start.
+ */
+long dag_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000L + ts.tv_nsec / 1000000L);
+}
+
+/**
+ * dag_cycle - Checks that the tasks' dependencies have no cycle.
+ *
+ * @info: The parameter struct.
+ * @d: The run, with its tasks linked.
+ *
+ * The tasks are marked finished in rounds, each taking those whose
+ * dependencies all are; any left over depend on each other in a cycle.
+ * Every task is then left waiting for all its dependencies.
+ *
+ * Return: 0 if there is no cycle, 1 if there is (after reporting it).
+ */
+static int dag_cycle(info_t *info, dag_t *d)
+{
+	int i, j, k, more = 1;
+	task_t *t;
+
+	for (k = 0; more;)
+		for (more = 0, i = 0; i < d->n; i++)
+		{
+			t = &(d->task[i]);
+			for (j = 0; t->state != TASK_OK && j < t->ndep; j++)
+				if (d->task[t->dep[j]].state != TASK_OK)
+					break;
+			if (t->state != TASK_OK && j == t->ndep)
+				t->state = TASK_OK, k++, more = 1;
+		}
+	for (t = d->task; t < d->task + d->n; t++)
+		t->state = TASK_WAIT, t->waiting = t->ndep;
+	if (k < d->n)
+		print_error(info, "dependency cycle\n");
+	return (k < d->n);
+}
+
+/**
+ * dag_link - Resolves the dependency names of every task.
+ *
+ * @info: The parameter struct whose arena holds the indexes.
+ * @d: The run, with its tasks parsed.
+ *
+ * Return: 0 on success, 1 on an unknown name, a cycle or allocation
+ *         failure (after reporting it).
+ */
+static int dag_link(info_t *info, dag_t *d)
+{
+	arena_t *a = &(info->arena);
+	int i, j, k;
+	char **w;
+	task_t *t;
+
+	for (i = 0; i < d->n; i++)
+	{
+		t = &(d->task[i]);
+		t->ndep = split_words(t->deps, NULL);
+		t->dep = arena_alloc(a, sizeof(int) * (t->ndep + 1));
+		w = arena_alloc(a, sizeof(char *) * (t->ndep + 1));
+		if (!t->dep || !w)
+			return (print_error(info, "out of memory\n"), 1);
+		split_words(t->deps, w);
+		for (j = 0; j < t->ndep; j++)
+		{
+			for (k = 0; k < d->n && _strcmp(d->task[k].name, w[j]);)
+				k++;
+			if (k == d->n)
+				return (print_error(info, ""), _eputs(t->name),
+					_eputs(": no task named "),
+					_eputs(w[j]), _eputchar('\n'), 1);
+			t->dep[j] = k;
+		}
+	}
+	return (dag_cycle(info, d));
+}
+
+/**
+ * dag_parse - Reads the tasks of a task file.
+ *
+ * @info: The parameter struct whose arena holds the tasks.
+ * @d: The run; its task and n are set.
+ * @line: The file's non-empty lines.
+ * @n: How many there are.
+ *
+ * A task is a line "name: dep...", followed by the lines of its command,
+ * each indented by a tab or spaces, as in a makefile. A task with no
+ * command only groups its dependencies. Lines starting with # are
+ * comments. Every name must be defined once.
+ *
+ * Return: 0 on success, 1 on a bad file (after reporting it).
+ */
+int dag_parse(info_t *info, dag_t *d, char **line, int n)
+{
+	task_t *t = NULL;
+	char *p, *cmd;
+	int i, k;
+
+	d->task = arena_alloc(&(info->arena), sizeof(task_t) * (n + 1));
+	for (d->n = 0, i = 0; d->task && i < n; i++)
+	{
+		for (p = line[i]; *p == ' ' || *p == '\t'; p++)
+			;
+		if (!*p || *p == '#')
+			continue;
+		if (p > line[i] && t)
+		{
+			cmd = !t->cmd ? NULL : arena_alloc(&(info->arena),
+					_strlen(t->cmd) + _strlen(p) + 2);
+			if (cmd)
+				_strcpy(cmd, t->cmd), _strcat(cmd, "\n");
+			t->cmd = !t->cmd ? p : cmd ? _strcat(cmd, p) : t->cmd;
+			continue;
+		}
+		p = _strchr(line[i], ':');
+		if (!p || p == line[i] || *line[i] == ' ' || *line[i] == '\t')
+			return (print_error(info, "bad line: "),
+					_eputs(line[i]), _eputchar('\n'), 1);
+		t = &(d->task[d->n++]);
+		_memset((char *)t, 0, sizeof(task_t));
+		t->name = line[i], t->deps = p + 1, t->via = -1;
+		for (*p = '\0'; p > line[i] && (p[-1] == ' ' || p[-1] == '\t');)
+			*--p = '\0';
+		for (k = 0; k < d->n - 1 && _strcmp(d->task[k].name, t->name);)
+			k++;
+		if (k < d->n - 1)
+			return (print_error(info, ""), _eputs(t->name),
+					_eputs(": defined twice\n"), 1);
+	}
+	return (!d->task || dag_link(info, d));
+}
+
+/**
+ * dag_summary - Reports how a dag run went, to stderr.
+ *
+ * @d: The run, finished.
+ * @wall: How long it took, in milliseconds.
+ *
+ * The counts of tasks are followed by the critical path: the chain of
+ * dependencies whose run times add up to the most, which bounds how
+ * fast the whole graph can go however many run at once.
+ */
+void dag_summary(dag_t *d, long wall)
+{
+	int i, end = -1, ok = 0, prev = -1, next;
+	task_t *t;
+
+	for (i = 0; i < d->n; i++)
+	{
+		t = &(d->task[i]);
+		ok += t->state == TASK_OK;
+		if ((t->state == TASK_OK || t->state == TASK_FAIL)
+				&& (end == -1 || t->path > d->task[end].path))
+			end = i;
+	}
+	_eputs("dag: "), print_d(ok, STDERR_FILENO), _eputs(" ok, ");
+	print_d(d->failed, STDERR_FILENO), _eputs(" failed, ");
+	print_d(d->n - ok - d->failed, STDERR_FILENO), _eputs(" not run, ");
+	print_d(wall, STDERR_FILENO), _eputs(" ms\n");
+	if (end == -1)
+		return;
+	_eputs("critical path: "), print_d(d->task[end].path, STDERR_FILENO);
+	_eputs(" ms\n");
+	for (i = end; i != -1; prev = i, i = next) /* turn the chain around */
+		next = d->task[i].via, d->task[i].via = prev;
+	for (i = prev; i != -1; i = d->task[i].via)
+	{
+		_eputs("  "), _eputs(d->task[i].name), _eputs(" ");
+		print_d(d->task[i].took, STDERR_FILENO), _eputs(" ms\n");
+	}
+}
@@ -0,0 +1,159 @@
+/*
+ * File_name: env_store.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+static list_t tombstone;
+
+/**
+ * env_hash - Hashes a variable name up to its '=' or end.
+ *
+ * @name: The name ("PATH") or entry ("PATH=/bin") to hash.
+ * @len: Where the length of the name part is stored.
+ *
+ * Return: The hash of the name.
+ */
+static size_t env_hash(const char *name, size_t *len)
+{
+	size_t h = 5381, i;
+
+	for (i = 0; name[i] && name[i] != '='; i++)
+		h = h * 33 + (unsigned char)name[i];
+	*len = i;
+	return (h);
+}
+
+/**
+ * env_slot - Finds the index slot holding a variable.
+ *
+ * @info: The info struct holding the environment index.
+ * @name: The variable name, optionally followed by '=' and anything.
+ * @free_slot: If not NULL, where to store the slot a new entry for
+ *             @name should go in (the first tombstone or empty slot).
+ *
+ * Return: The slot holding @name's node, or NULL if it is not indexed.
+ */
+static list_t **env_slot(info_t *info, const char *name, list_t ***free_slot)
+{
+	envidx_t *idx = &(info->env_idx);
+	size_t len, i, mask = idx->size - 1;
+	list_t **slot;
+
+	if (free_slot)
+		*free_slot = NULL;
+	if (!idx->size)
+		return (NULL);
+	for (i = env_hash(name, &len) & mask;; i = (i + 1) & mask)
+	{
+		slot = &(idx->slots[i]);
+		if (!*slot)
+			break;
+		if (*slot == &tombstone)
+		{
+			if (free_slot && !*free_slot)
+				*free_slot = slot;
+			continue;
+		}
+		if (!_strncmp((*slot)->str, (char *)name, len)
+				&& (*slot)->str[len] == '=')
+			return (slot);
+	}
+	if (free_slot && !*free_slot)
+		*free_slot = slot;
+	return (NULL);
+}
+
+/**
+ * env_grow - Rebuilds the environment index without its tombstones.
+ *
+ * @info: The info struct holding the environment index.
+ *
+ * The table only doubles when the live nodes fill more than a quarter
+ * of it. A shell that keeps setting and unsetting variables mostly fills
+ * it with tombstones, and those are just cleared at the same size.
+ *
+ * Return: 0 on success, 1 on allocation failure.
+ */
+static int env_grow(info_t *info)
+{
+	envidx_t *idx = &(info->env_idx);
+	size_t i, old_size = idx->size;
+	list_t **old = idx->slots, **slot;
+
+	idx->size = !old_size ? 64 : (idx->live + 1) * 4 <= old_size
+		? old_size : old_size * 2;
+	idx->slots = malloc(sizeof(list_t *) * idx->size);
+	if (!idx->slots)
+	{
+		idx->slots = old;
+		idx->size = old_size;
+		return (1);
+	}
+	_memset((void *)idx->slots, 0, sizeof(list_t *) * idx->size);
+	idx->used = 0;
+	for (i = 0; i < old_size; i++)
+		if (old[i] && old[i] != &tombstone)
+		{
+			env_slot(info, old[i]->str, &slot);
+			*slot = old[i];
+			idx->used++;
+		}
+	free(old);
+	return (0);
+}
+
+/**
+ * env_lookup - Finds the environment node of a variable.
+ *
+ * @info: The info struct holding the environment.
+ * @name: The variable name; anything from an '=' on is ignored, so
+ *        "PATH" and "PATH=" find the same node.
+ *
+ * Return: The node holding "name=value", or NULL if it is not set.
+ */
+list_t *env_lookup(info_t *info, const char *name)
+{
+	list_t **slot = env_slot(info, name, NULL);
+
+	return (slot ? *slot : NULL);
+}
+
+/**
+ * env_index - Adds a node to, or removes it from, the environment index.
+ *
+ * @info: The info struct holding the environment index.
+ * @node: The node whose str is "name=value".
+ * @add: 1 to index @node, 0 to forget it.
+ *
+ * Only the index is touched; the list in info->env is left to the
+ * caller, so it keeps the order variables were first set in.
+ *
+ * Return: 0 on success, 1 on allocation failure.
+ */
+int env_index(info_t *info, list_t *node, int add)
+{
+	envidx_t *idx = &(info->env_idx);
+	list_t **slot, **free_slot;
+
+	if (add && (idx->used + 1) * 2 > idx->size && env_grow(info))
+		return (1);
+	slot = env_slot(info, node->str, &free_slot);
+	if (!add)
+	{
+		if (slot)
+			*slot = &tombstone, idx->live--;
+		return (0);
+	}
+	if (slot)
+		*slot = node;
+	else
+	{
+		if (!*free_slot)
+			idx->used++;
+		*free_slot = node, idx->live++;
+	}
+	return (0);
+}
@@ -13,13 +13,21 @@
  *        function prototype.
  *
  * This function prints the current environment variables to the standard
- * output. It takes an 'info_t' structure to maintain a uniform function
- * signature but doesn't use it for this operation.
+ * output. With -s it instead prints how many times the exec-ready
+ * environment array had to be built from scratch, which stays at one
+ * once commands have been run.
  *
  * Return: Always returns 0.
  */
 int _myenv(info_t *info)
 {
+	if (info->argv[1] && !_strcmp(info->argv[1], "-s"))
+	{
+		_puts("envp builds: ");
+		_puts(convert_number(info->env_builds, 10, 0));
+		_puts("\n");
+		return (0);
+	}
 	print_list_str(info->env);
 	return (0);
 }
@@ -30,25 +38,22 @@ int _myenv(info_t *info)
  * @info: Structure containing relevant program information.
  * @name: Name of the environment variable to retrieve.
  *
- * This function searches for the environment variable specified by @name
- * within the program's environment variables, which are stored in the
- * @info structure. If found, it returns the corresponding value.
+ * This function looks the environment variable specified by @name up
+ * in the name index over the program's environment variables, which are
+ * stored in the @info structure. If found, it returns the corresponding
+ * value. A trailing '=' on @name ("PATH=") is accepted and ignored.
  *
  * Return: The value of the environment variable if found, NULL if not found.
  */
 char *_getenv(info_t *info, const char *name)
 {
-	list_t *node = info->env;
+	list_t *node = env_lookup(info, name);
 	char *p;
 
-	while (node)
-	{
-		p = starts_with(node->str, name);
-		if (p && *p)
-			return (p);
-		node = node->next;
-	}
-	return (NULL);
+	if (!node)
+		return (NULL);
+	p = _strchr(node->str, '=') + 1;
+	return (*p ? p : NULL);
 }
 
 /**
@@ -106,7 +111,8 @@ int _myunsetenv(info_t *info)
  * populate_env_list - Create and populate an environment linked list.
  *
  * This function initializes and populates a linked list with environment
- * variables based on the provided `info` structure.
+ * variables based on the provided `info` structure, indexing each one by
+ * name. Only the first of several entries for the same name is kept.
  *
  * @info: A structure containing potential arguments and other data needed
  *        for processing.
@@ -115,11 +121,10 @@ int _myunsetenv(info_t *info)
  */
 int populate_env_list(info_t *info)
 {
-	list_t *node = NULL;
 	size_t i;
 
 	for (i = 0; environ[i]; i++)
-		add_node_end(&node, environ[i], 0);
-	info->env = node;
+		if (!env_lookup(info, environ[i]))
+			env_append(info, environ[i]);
 	return (0);
 }
@@ -17,15 +17,8 @@
  */
 void _eputs(char *str)
 {
-	int i = 0;
-
-	if (!str)
-		return;
-	while (str[i] != '\0')
-	{
-		_eputchar(str[i]);
-		i++;
-	}
+	if (str)
+		w_write(STDERR_FILENO, str, _strlen(str));
 }
 
 /**
@@ -38,17 +31,9 @@ void _eputs(char *str)
  */
 int _eputchar(char c)
 {
-	static int i;
-	static char buf[WRITE_BUF_SIZE];
-
-	if (c == BUF_FLUSH || i >= WRITE_BUF_SIZE)
-	{
-		write(2, buf, i);
-		i = 0;
-	}
-	if (c != BUF_FLUSH)
-		buf[i++] = c;
-	return (1);
+	if (c == BUF_FLUSH)
+		return (w_flush(STDERR_FILENO) ? -1 : 1);
+	return (w_write(STDERR_FILENO, &c, 1));
 }
 
 /**
@@ -65,17 +50,9 @@ int _eputchar(char c)
  */
 int _putfd(char c, int fd)
 {
-	static int i;
-	static char buf[WRITE_BUF_SIZE];
-
-	if (c == BUF_FLUSH || i >= WRITE_BUF_SIZE)
-	{
-		write(fd, buf, i);
-		i = 0;
-	}
-	if (c != BUF_FLUSH)
-		buf[i++] = c;
-	return (1);
+	if (c == BUF_FLUSH)
+		return (w_flush(fd) ? -1 : 1);
+	return (w_write(fd, &c, 1));
 }
 
 /**
@@ -93,13 +70,7 @@ int _putfd(char c, int fd)
  */
 int _putsfd(char *str, int fd)
 {
-	int i = 0;
-
 	if (!str)
 		return (0);
-	while (*str)
-	{
-		i += _putfd(*str++, fd);
-	}
-	return (i);
+	return (w_write(fd, str, _strlen(str)));
 }
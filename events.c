@@ -0,0 +1,162 @@
+/*
+ * File_name: events.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * ev_init - Sets up the descriptors the shell waits on.
+ *
+ * @info: The parameter struct; info->ev is filled in.
+ *
+ * SIGCHLD, SIGINT and SIGWINCH are blocked and read from a signalfd
+ * instead, so they are only ever handled from the main loop, never in
+ * the middle of a write or a malloc(). The signalfd and a timerfd for
+ * TMOUT go in an epoll set, to which ev_wait() adds the input. If any
+ * of it cannot be made the signals are left to their handlers.
+ *
+ * Return: 0 on success, 1 if the shell falls back to handlers.
+ */
+int ev_init(info_t *info)
+{
+	ev_t *ev = &(info->ev);
+	struct epoll_event e;
+	sigset_t set;
+
+	sigemptyset(&set);
+	sigaddset(&set, SIGCHLD);
+	sigaddset(&set, SIGINT);
+	sigaddset(&set, SIGWINCH);
+	if (sigprocmask(SIG_BLOCK, &set, &(ev->mask)))
+		return (1);
+	ev->sig = signalfd(-1, &set, SFD_NONBLOCK | SFD_CLOEXEC);
+	ev->ep = epoll_create1(EPOLL_CLOEXEC);
+	ev->timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	e.events = EPOLLIN, e.data.fd = ev->sig;
+	if (ev->sig == -1 || ev->ep == -1
+			|| epoll_ctl(ev->ep, EPOLL_CTL_ADD, ev->sig, &e))
+	{
+		close(ev->sig), close(ev->ep), close(ev->timer);
+		ev->sig = ev->ep = ev->timer = -1;
+		sigprocmask(SIG_SETMASK, &(ev->mask), NULL);
+		return (1);
+	}
+	e.data.fd = ev->timer;
+	if (ev->timer != -1 && epoll_ctl(ev->ep, EPOLL_CTL_ADD, ev->timer, &e))
+		close(ev->timer), ev->timer = -1;
+	return (0);
+}
+
+/**
+ * ev_signals - Handles the signals that have come in.
+ *
+ * @info: The parameter struct.
+ * @prompt: 1 while waiting at the prompt, 0 between commands.
+ *
+ * SIGCHLD is only noted for jobs_reap(). SIGINT starts a fresh prompt
+ * at the prompt, and between commands (a ^C that stopped the last one)
+ * just ends its line. SIGWINCH updates COLUMNS and LINES, if they are
+ * set; the shell does not export them of its own accord. Between
+ * commands a shell reading a script with no jobs has nothing to do for
+ * any of them, so it does not look.
+ */
+void ev_signals(info_t *info, int prompt)
+{
+	struct signalfd_siginfo si;
+	struct winsize ws;
+	char *n;
+
+	if (info->ev.sig == -1 || (!prompt && !interactive(info)
+				&& !info->jobs))
+		return;
+	while (read(info->ev.sig, &si, sizeof(si)) == sizeof(si))
+		if (si.ssi_signo == SIGCHLD)
+			info->ev.chld = 1;
+		else if (si.ssi_signo == SIGINT && interactive(info))
+			_puts(prompt ? "\n$ " : "\n"), _putchar(BUF_FLUSH);
+		else if (si.ssi_signo == SIGWINCH && info->is_tty
+				&& !ioctl(STDIN_FILENO, TIOCGWINSZ, &ws))
+		{
+			n = convert_number(ws.ws_col, 10, 0);
+			if (_getenv(info, "COLUMNS="))
+				_setenv(info, "COLUMNS", n);
+			n = convert_number(ws.ws_row, 10, 0);
+			if (_getenv(info, "LINES="))
+				_setenv(info, "LINES", n);
+		}
+}
+
+/**
+ * ev_wait - Waits for input, handling signals and timeouts meanwhile.
+ *
+ * @info: The parameter struct whose readfd is about to be read.
+ *
+ * A background job that finishes while the shell sits at the prompt is
+ * reported at once, and the prompt drawn again under it; a child that
+ * exits without finishing a job leaves the prompt alone. An interactive
+ * shell with TMOUT set to a number of seconds gives up on input after
+ * that long. Input that cannot be polled is read straight away.
+ *
+ * Return: 0 once input is ready (or should just be read), -1 if TMOUT
+ *         ran out.
+ */
+int ev_wait(info_t *info)
+{
+	ev_t *ev = &(info->ev);
+	struct itimerspec t;
+	struct epoll_event e;
+	char *tmout = _getenv(info, "TMOUT=");
+	long secs = 0;
+	int n;
+
+	if (ev->in == -1 && ev->ep != -1)
+	{
+		e.events = EPOLLIN, e.data.fd = info->readfd;
+		ev->in = epoll_ctl(ev->ep, EPOLL_CTL_ADD, info->readfd, &e)
+			? -2 : info->readfd;
+	}
+	if (ev->in < 0)
+		return (0);
+	_memset((char *)&t, 0, sizeof(t));
+	if (tmout && !_atol(tmout, &secs) && secs > 0)
+		t.it_value.tv_sec = secs;
+	if (interactive(info)) /* also disarms what the last wait left */
+		timerfd_settime(ev->timer, 0, &t, NULL);
+	while (1)
+	{
+		n = epoll_wait(ev->ep, &e, 1, -1);
+		if (n == -1 && errno == EINTR)
+			continue;
+		if (n == -1 || e.data.fd != ev->sig)
+			break;
+		ev_signals(info, 1);
+		if (!ev->chld || !info->jobs || !interactive(info)
+				|| !jobs_reap(info, 0))
+			continue;
+		_putchar('\n'), jobs_report(info, 0);
+		_puts("$ "), _putchar(BUF_FLUSH);
+	}
+	if (n == 1 && e.data.fd == ev->timer)
+		_eputs("timed out waiting for input: auto-logout\n");
+	return (n == 1 && e.data.fd == ev->timer ? -1 : 0);
+}
+
+/**
+ * ev_child - Undoes ev_init() in a child of the shell.
+ *
+ * @info: The parameter struct.
+ *
+ * The child gets back the signal mask the shell started with, so what
+ * it runs sees SIGINT and the rest as usual. Its copies of the
+ * descriptors are close-on-exec, and forgotten here for a forked
+ * builtin that closed them.
+ */
+void ev_child(info_t *info)
+{
+	if (info->ev.sig == -1)
+		return;
+	sigprocmask(SIG_SETMASK, &(info->ev.mask), NULL);
+	info->ev.sig = info->ev.ep = info->ev.timer = info->ev.in = -1;
+}
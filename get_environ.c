@@ -7,21 +7,41 @@
 #include "shell.h"
 
 /**
- * get_environ - Creates a copy of the system environment variables.
+ * get_environ - Returns the exec-ready copy of the environment.
  *
  * @info: Pointer to a structure holding function arguments (maintains
  *        prototype consistency).
  *
- * Return: Always returns 0.
+ * The array is built from the env list once; after that _setenv(),
+ * _unsetenv() and env_append() patch it in place. Its slots share the
+ * strings of the env nodes, and each node's num is its slot.
+ *
+ * Return: The NULL-terminated environment array.
  */
 char **get_environ(info_t *info)
 {
-	if (!info->environ || info->env_changed)
+	list_t *node;
+	int i, cap;
+
+	if (!info->environ)
 	{
-		info->environ = list_to_strings(info->env);
-		info->env_changed = 0;
+		cap = 16;
+		while (cap <= (int)list_len(info->env))
+			cap *= 2;
+		info->environ = malloc(sizeof(char *) * cap);
+		if (!info->environ)
+			return (NULL);
+		for (i = 0, node = info->env; node; node = node->next, i++)
+		{
+			node->num = i;
+			info->environ[i] = node->str;
+		}
+		info->environ[i] = NULL;
+		info->env_count = i;
+		info->env_cap = cap;
+		info->env_builds++;
 	}
-
+	info->env_changed = 0;
 	return (info->environ);
 }
 
@@ -36,27 +56,35 @@ char **get_environ(info_t *info)
  */
 int _unsetenv(info_t *info, char *var)
 {
-	list_t *node = info->env;
-	size_t i = 0;
-	char *p;
+	list_t *node, *prev = NULL, *target;
 
-	if (!node || !var)
+	if (!info->env || !var)
 		return (0);
-
-	while (node)
+	if (!_strcmp(var, "PATH"))
+		hash_drop(info, NULL);
+	target = env_lookup(info, var);
+	if (!target)
+		return (0);
+	env_index(info, target, 0);
+	if (info->environ) /* move the last slot into the hole */
 	{
-		p = starts_with(node->str, var);
-		if (p && *p == '=')
-		{
-			info->env_changed = delete_node_at_index(&(info->env), i);
-			i = 0;
-			node = info->env;
-			continue;
-		}
-		node = node->next;
-		i++;
+		node = env_lookup(info, info->environ[--info->env_count]);
+		info->environ[target->num] = info->environ[info->env_count];
+		info->environ[info->env_count] = NULL;
+		if (node)
+			node->num = target->num;
 	}
-	return (info->env_changed);
+	for (node = info->env; node != target; node = node->next)
+		prev = node;
+	if (prev)
+		prev->next = target->next;
+	else
+		info->env = target->next;
+	if (info->env_tail == target)
+		info->env_tail = prev;
+	free(target->str);
+	free(target);
+	return (info->env_changed = 1);
 }
 
 /**
@@ -73,10 +101,11 @@ int _setenv(info_t *info, char *var, char *value)
 {
 	char *buf = NULL;
 	list_t *node;
-	char *p;
 
 	if (!var || !value)
 		return (0);
+	if (!_strcmp(var, "PATH"))
+		hash_drop(info, NULL);
 
 	buf = malloc(_strlen(var) + _strlen(value) + 2);
 	if (!buf)
@@ -84,21 +113,57 @@ int _setenv(info_t *info, char *var, char *value)
 	_strcpy(buf, var);
 	_strcat(buf, "=");
 	_strcat(buf, value);
-	node = info->env;
-	while (node)
+	node = env_lookup(info, var);
+	if (node)
 	{
-		p = starts_with(node->str, var);
-		if (p && *p == '=')
-		{
-			free(node->str);
-			node->str = buf;
-			info->env_changed = 1;
-			return (0);
-		}
-		node = node->next;
+		free(node->str);
+		node->str = buf;
+		if (info->environ)
+			info->environ[node->num] = buf;
+		info->env_changed = 1;
+		return (0);
 	}
-	add_node_end(&(info->env), buf, 0);
+	env_append(info, buf);
 	free(buf);
 	info->env_changed = 1;
 	return (0);
 }
+
+/**
+ * env_append - Adds a "name=value" entry at the end of the environment.
+ *
+ * @info: The info struct holding the environment.
+ * @str: The entry to copy in; its name must not be set already.
+ *
+ * The entry is also pushed onto the exec-ready array if one is built,
+ * doubling it when full.
+ *
+ * Return: The new node, or NULL on failure.
+ */
+list_t *env_append(info_t *info, char *str)
+{
+	list_t *node;
+	char **envp;
+	unsigned int size = sizeof(char *) * info->env_cap;
+
+	node = add_node_end(info->env ? &(info->env_tail) : &(info->env),
+			str, 0);
+	if (!node)
+		return (NULL);
+	info->env_tail = node;
+	env_index(info, node, 1);
+	if (!info->environ)
+		return (node);
+	if (info->env_count + 1 >= info->env_cap)
+	{
+		envp = _realloc(info->environ, size, size * 2);
+		if (!envp) /* let get_environ() build it afresh */
+			return (bfree((void **)&(info->environ)), node);
+		info->environ = envp;
+		info->env_cap *= 2;
+	}
+	node->num = info->env_count;
+	info->environ[info->env_count++] = node->str;
+	info->environ[info->env_count] = NULL;
+	return (node);
+}
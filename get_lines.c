@@ -18,34 +18,27 @@
 ssize_t input_buf(info_t *info, char **buf, size_t *len)
 {
 	ssize_t r = 0;
-	size_t len_p = 0;
 
 	if (!*len) /* if nothing left in the buffer, fill it */
 	{
-		/*bfree((void **)info->cmd_buf);*/
-		free(*buf);
-		*buf = NULL;
-		signal(SIGINT, sigintHandler);
+		doc_close(info); /* bodies the last line never used */
 #if USE_GETLINE
-		r = getline(buf, &len_p, stdin);
+		r = getline(&(info->in.buf), &(info->in.size), stdin);
+		*buf = info->in.buf;
 #else
-		r = _getline(info, buf, &len_p);
+		r = _getline(info, buf, NULL);
 #endif
 		if (r > 0)
 		{
-			if ((*buf)[r - 1] == '\n')
-			{
-				(*buf)[r - 1] = '\0'; /* remove trailing newline */
-				r--;
-			}
+			if ((*buf)[r - 1] == '\n') /* remove trailing newline */
+				(*buf)[r - 1] = '\0';
 			info->linecount_flag = 1;
-			remove_comments(*buf);
 			build_history_list(info, *buf, info->histcount++);
-			/* if (_strchr(*buf, ';')) is this a command chain? */
-			{
-				*len = r;
-				info->cmd_buf = buf;
-			}
+			lex_line(info, *buf); /* history keeps the raw line */
+			if (info->lex.docs)
+				doc_read(info);
+			*len = r;
+			info->cmd_buf = buf;
 		}
 	}
 	return (r);
@@ -56,49 +49,29 @@ ssize_t input_buf(info_t *info, char **buf, size_t *len)
  *
  * @info: A parameter structure containing input details.
  *
- * This function reads a line of input from the specified source and stores it
- * in the `info->input_buffer` while excluding the trailing newline character.
- * It updates `info->input_length` with the number of bytes read.
+ * A new line is read and split into tokens only once every command of
+ * the previous line has run; info->arg is then set to the next command
+ * by lex_next().
  *
- * Return: The number of bytes read, or -1 on error.
+ * Return: The length of the command's first word (0 if there is nothing
+ *         to run), or -1 on EOF.
  */
 ssize_t get_input(info_t *info)
 {
-	static char *buf; /* the ';' command chain buffer */
-	static size_t i, j, len;
+	static char *buf; /* the line being run, split by lex_line() */
+	static size_t len;
 	ssize_t r = 0;
-	char **buf_p = &(info->arg), *p;
 
 	_putchar(BUF_FLUSH);
 	r = input_buf(info, &buf, &len);
 	if (r == -1) /* EOF */
 		return (-1);
-	if (len) /* we have commands left in the chain buffer */
+	if (!lex_next(info)) /* last command of the line */
 	{
-		j = i; /* init new iterator to current buf position */
-		p = buf + i; /* get pointer for return */
-
-		check_chain(info, buf, &j, i, len);
-		while (j < len) /* iterate to semicolon or end */
-		{
-			if (is_chain(info, buf, &j))
-				break;
-			j++;
-		}
-
-		i = j + 1; /* increment past nulled ';'' */
-		if (i >= len) /* reached end of buffer? */
-		{
-			i = len = 0; /* reset position and length */
-			info->cmd_buf_type = CMD_NORM;
-		}
-
-		*buf_p = p; /* pass back pointer to current command position */
-		return (_strlen(p)); /* return length of current command */
+		len = 0;
+		info->cmd_buf_type = CMD_NORM;
 	}
-
-	*buf_p = buf; /* else not a chain, pass back buffer from _getline() */
-	return (r); /* return length of buffer from _getline() */
+	return (_strlen(info->arg)); /* length of the command's first word */
 }
 
 /**
@@ -106,73 +79,94 @@ ssize_t get_input(info_t *info)
  * embark on a quest to read a buffer.
  *
  * @info: The wise parameter struct guiding your journey.
- * @buf: The ancient scroll-like buffer containing hidden knowledge.
- * @i: The magical size that shapes the destiny of your reading.
+ *
+ * The unread tail is first slid to the front of the buffer, and the
+ * buffer is doubled if that still leaves less than one chunk free, so
+ * a long line costs amortised O(1) copying per byte. Chunks are
+ * READ_BUF_SIZE for a terminal and READ_BIG_SIZE otherwise. A script
+ * that is a regular file is mapped whole on the first call instead.
  *
  * Return: The mystical r, revealing the secrets of what has been read.
  */
-ssize_t read_buf(info_t *info, char *buf, size_t *i)
+ssize_t read_buf(info_t *info)
 {
-	ssize_t r = 0;
+	inbuf_t *in = &(info->in);
+	size_t size;
+	ssize_t r;
+	char *buf;
 
-	if (*i)
-		return (0);
-	r = read(info->readfd, buf, READ_BUF_SIZE);
-	if (r >= 0)
-		*i = r;
+	if (!in->chunk)
+	{
+		in->chunk = interactive(info) ? READ_BUF_SIZE : READ_BIG_SIZE;
+		if (in_map(info))
+			return (in->end);
+	}
+	if (in->pos && in->size - in->end <= in->chunk)
+	{
+		memmove(in->buf, in->buf + in->pos, in->end - in->pos);
+		in->end -= in->pos;
+		in->pos = 0;
+	}
+	if (in->size - in->end <= in->chunk)
+	{
+		for (size = in->size ? in->size * 2 : in->chunk * 2;
+				size - in->end <= in->chunk;)
+			size *= 2;
+		buf = realloc(in->buf, size);
+		if (!buf)
+			return (-1);
+		in->buf = buf;
+		in->size = size;
+	}
+	if (ev_wait(info)) /* TMOUT ran out */
+		return (in->eof = 1, 0);
+	r = read(info->readfd, in->buf + in->end, in->size - in->end - 1);
+	if (r > 0)
+		in->end += r;
+	else if (!r)
+		in->eof = 1;
 	return (r);
 }
 
 /**
  * _getline - Retrieve the next line of input from STDIN.
  *
- * This function reads input from STDIN and stores it in the provided buffer
- * or a dynamically allocated buffer if the pointer is NULL. The length of
- * the buffer is managed dynamically.
+ * The line is handed out in place, inside info->in, with its newline
+ * replaced by a terminator; it stays valid until the next call. The
+ * buffer is reused from line to line and only grows.
  *
  * @info: Parameter struct containing context information.
- * @ptr: Address of a pointer to the buffer, either preallocated or NULL.
- * @length: Size of the preallocated ptr buffer if not NULL.
+ * @ptr: Where the address of the line is stored.
+ * @length: If not NULL, where the length of the line is stored.
  *
- * Return: The next line of input as a string or NULL if an error occurs.
+ * Return: The number of bytes consumed, counting the newline, or -1 at
+ *         the end of input or on a read error.
  */
 int _getline(info_t *info, char **ptr, size_t *length)
 {
-	static char buf[READ_BUF_SIZE];
-	static size_t i, len;
-	size_t k;
-	ssize_t r = 0, s = 0;
-	char *p = NULL, *new_p = NULL, *c;
-
-	p = *ptr;
-	if (p && length)
-		s = *length;
-	if (i == len)
-		i = len = 0;
-
-	r = read_buf(info, buf, &len);
-	if (r == -1 || (r == 0 && len == 0))
-		return (-1);
-
-	c = _strchr(buf + i, '\n');
-	k = c ? 1 + (unsigned int)(c - buf) : len;
-	new_p = _realloc(p, s, s ? s + k : k + 1);
-	if (!new_p) /* MALLOC FAILURE! */
-		return (p ? free(p), -1 : -1);
-
-	if (s)
-		_strncat(new_p, buf + i, k - i);
-	else
-		_strncpy(new_p, buf + i, k - i + 1);
-
-	s += k - i;
-	i = k;
-	p = new_p;
+	inbuf_t *in = &(info->in);
+	char *c;
+	size_t len;
 
+	while (1)
+	{
+		c = _memchr(in->buf + in->pos + in->scan, '\n',
+				in->end - in->pos - in->scan);
+		if (c || (in->eof && in->end > in->pos))
+			break;
+		in->scan = in->end - in->pos;
+		if (in->eof || read_buf(info) == -1)
+			return (-1);
+	}
+	len = c ? (size_t)(c - in->buf) - in->pos : in->end - in->pos;
+	*ptr = in->buf + in->pos;
+	(*ptr)[len] = '\0';
+	in_trim(info, in->pos);
+	in->pos += c ? len + 1 : len;
+	in->scan = 0;
 	if (length)
-		*length = s;
-	*ptr = p;
-	return (s);
+		*length = len;
+	return (c ? len + 1 : len);
 }
 
 /**
@@ -183,13 +177,14 @@ int _getline(info_t *info, char **ptr, size_t *length)
  * Description:
  * This function serves as a custom signal handler for Ctrl-C (SIGINT) signals.
  * It captures and suppresses the signal, allowing for graceful termination
- * of a process without abrupt interruptions.
+ * of a process without abrupt interruptions. It only runs when ev_init()
+ * could not take SIGINT over, and writes the new prompt directly, as the
+ * output buffer may be half-way through a write of its own.
  *
  * Return: Void.
  */
 void sigintHandler(__attribute__((unused)) int sig_num)
 {
-	_puts("\n");
-	_puts("$ ");
-	_putchar(BUF_FLUSH);
+	if (write(STDOUT_FILENO, "\n$ ", 3) == -1)
+		return;
 }
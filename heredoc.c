@@ -0,0 +1,130 @@
+/*
+ * File_name: heredoc.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * doc_body - Reads one here-document's body into an anonymous file.
+ *
+ * @info: The parameter struct holding the input buffer.
+ * @delim: The line that ends the body.
+ * @tabs: 1 for <<-, which strips leading tabs from every line.
+ *
+ * Lines come straight out of the input buffer through _getline() and
+ * go through a writer into a memfd, so a body of any size costs no
+ * disk I/O and only one write per WRITE_BUF_SIZE bytes. The body is
+ * consumed even if the memfd cannot be made, so it never runs as
+ * commands.
+ *
+ * Return: The memfd, rewound for reading, or -1 on failure.
+ */
+static int doc_body(info_t *info, char *delim, int tabs)
+{
+	int fd = memfd_create("heredoc", MFD_CLOEXEC);
+	char *line;
+	size_t len;
+
+	if (fd == -1)
+		perror("memfd_create");
+	while (1)
+	{
+		if (interactive(info))
+			_puts("> "), _putchar(BUF_FLUSH);
+		if (_getline(info, &line, &len) == -1)
+		{
+			_eputs(info->fname), _eputs(": warning: here-document "
+					"delimited by end-of-file (wanted `");
+			_eputs(delim), _eputs("')\n");
+			break;
+		}
+		for (; tabs && *line == '\t'; line++)
+			len--;
+		if (!_strcmp(line, delim))
+			break;
+		if (fd != -1)
+			w_write(fd, line, len), w_write(fd, "\n", 1);
+	}
+	if (fd != -1)
+		w_flush(fd), lseek(fd, 0, SEEK_SET);
+	return (fd);
+}
+
+/**
+ * doc_read - Reads the bodies of the here-documents of a new line.
+ *
+ * @info: The parameter struct holding the lexed line.
+ *
+ * The bodies follow the line in the input, in the order their << come.
+ * Reading them lets the input buffer move or drop what is behind, so
+ * the line is first copied out and the tokens pointed at the copy. If
+ * it cannot be, the tokens would be left pointing into the buffer, so
+ * the line is dropped with an error and no body is read.
+ */
+void doc_read(info_t *info)
+{
+	lex_t *lx = &(info->lex);
+	char *copy = malloc(lx->eol + 1);
+	token_t *tok;
+	int i;
+
+	if (!copy)
+	{
+		lex_drop(info, "out of memory\n");
+		return;
+	}
+	memcpy(copy, lx->line, lx->eol + 1);
+	free(lx->copy);
+	lx->copy = lx->line = copy;
+	for (i = 0; i + 1 < lx->count; i++)
+	{
+		tok = &(lx->tok[i]);
+		if ((tok->kind == TOK_DLESS || tok->kind == TOK_DLESSDASH)
+				&& tok[1].kind == TOK_WORD)
+			tok->fd = doc_body(info, lx->line + tok[1].off,
+					tok->kind == TOK_DLESSDASH);
+	}
+}
+
+/**
+ * doc_string - Stores the word of a <<< here-string.
+ *
+ * @s: The word; a newline is added after it.
+ *
+ * Return: A memfd holding it, rewound for reading, or -1 on failure.
+ */
+int doc_string(char *s)
+{
+	int fd = memfd_create("herestring", MFD_CLOEXEC);
+
+	if (fd == -1)
+		return (-1);
+	w_write(fd, s, _strlen(s));
+	w_write(fd, "\n", 1);
+	w_flush(fd);
+	lseek(fd, 0, SEEK_SET);
+	return (fd);
+}
+
+/**
+ * doc_close - Closes the bodies no command of the last line took.
+ *
+ * @info: The parameter struct holding the lexed line.
+ *
+ * A command skipped by && or ||, or stopped by a syntax error, never
+ * opens its redirections.
+ */
+void doc_close(info_t *info)
+{
+	lex_t *lx = &(info->lex);
+	int i;
+
+	for (i = 0; lx->docs && i < lx->count; i++)
+		if (lx->tok[i].fd != -1)
+		{
+			close(lx->tok[i].fd);
+			lx->tok[i].fd = -1;
+		}
+}
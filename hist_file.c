@@ -0,0 +1,130 @@
+/*
+ * File_name: hist_file.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * hist_slurp - Reads a whole history file into memory.
+ *
+ * @fd: The open history file, read from its current offset.
+ * @size: Where the number of bytes read is stored.
+ *
+ * Return: A NUL-terminated buffer to be freed by the caller, or NULL
+ *         if the file is empty or cannot be read.
+ */
+char *hist_slurp(int fd, ssize_t *size)
+{
+	struct stat st;
+	ssize_t r, len = 0;
+	char *buf;
+
+	*size = 0;
+	if (fstat(fd, &st) || st.st_size < 1)
+		return (NULL);
+	buf = malloc(st.st_size + 1);
+	if (!buf)
+		return (NULL);
+	while (len < st.st_size)
+	{
+		r = read(fd, buf + len, st.st_size - len);
+		if (r <= 0)
+			break;
+		len += r;
+	}
+	if (!len)
+		return (free(buf), NULL);
+	buf[len] = 0;
+	*size = len;
+	return (buf);
+}
+
+/**
+ * hist_count - Counts the lines of a history file, a block at a time.
+ *
+ * @fd: The open history file, read from its current offset.
+ *
+ * Return: The number of lines.
+ */
+int hist_count(int fd)
+{
+	char buf[READ_BUF_SIZE * 4];
+	ssize_t r, i;
+	int lines = 0;
+
+	while ((r = read(fd, buf, sizeof(buf))) > 0)
+		for (i = 0; i < r; i++)
+			lines += buf[i] == '\n';
+	return (lines);
+}
+
+/**
+ * hist_append - Appends the lines not yet saved to the history file.
+ *
+ * @info: The info struct holding the history.
+ * @fd: The history file, opened with O_APPEND and locked.
+ *
+ * Lines are gathered into an iovec so that a flush is a single writev()
+ * unless more than HIST_IOV / 2 lines are pending.
+ *
+ * Return: The number of lines written, or -1 on a write error.
+ */
+int hist_append(info_t *info, int fd)
+{
+	struct iovec iov[HIST_IOV];
+	history_t *h = &(info->history);
+	int i, n = 0, k = 0;
+	char *line;
+
+	i = h->count - (info->histcount - h->saved); /* first unsaved line */
+	if (i < 0)
+		i = 0;
+	for (; (line = hist_at(info, i, NULL)); i++, n++)
+	{
+		iov[k].iov_base = line;
+		iov[k++].iov_len = _strlen(line);
+		iov[k].iov_base = "\n";
+		iov[k++].iov_len = 1;
+		if (k == HIST_IOV || !hist_at(info, i + 1, NULL))
+		{
+			if (writev(fd, iov, k) == -1)
+				return (-1);
+			k = 0;
+		}
+	}
+	h->saved = info->histcount;
+	h->file_lines += n;
+	return (n);
+}
+
+/**
+ * hist_compact - Cuts the history file down to its last HIST_MAX lines.
+ *
+ * @info: The info struct holding the history.
+ * @fd: The history file, opened with O_APPEND and locked exclusively so
+ *      no other shell appends while it is rewritten.
+ *
+ * Return: 0 on success, -1 on failure.
+ */
+int hist_compact(info_t *info, int fd)
+{
+	ssize_t size, i;
+	int lines = 0;
+	char *buf;
+
+	if (lseek(fd, 0, SEEK_SET) == -1)
+		return (-1);
+	buf = hist_slurp(fd, &size);
+	if (!buf)
+		return (-1);
+	for (i = size - 1; i > 0; i--)
+		if (buf[i - 1] == '\n' && ++lines == HIST_MAX)
+			break;
+	if (i > 0 && (ftruncate(fd, 0) || write(fd, buf + i, size - i) == -1))
+		return (free(buf), -1);
+	info->history.file_lines = i > 0 ? lines : lines + 1;
+	free(buf);
+	return (0);
+}
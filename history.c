@@ -0,0 +1,159 @@
+/*
+ * File_name: history.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * hist_reserve - Makes room for n more bytes at the end of the arena.
+ *
+ * @h: The history store.
+ * @n: The number of bytes needed.
+ *
+ * Entries are appended in order and evicted from the front, so the live
+ * lines always form one run at the end of the arena. When the arena is
+ * full that run is slid back to the start, growing the arena first if
+ * the run would still fill more than half of it; each byte is thus moved
+ * a constant number of times on average.
+ *
+ * Return: 0 on success, 1 on allocation failure.
+ */
+static int hist_reserve(history_t *h, size_t n)
+{
+	size_t base, live, size, i;
+	char *arena;
+
+	if (h->used + n <= h->size)
+		return (0);
+	base = h->count ? h->ent[h->first].off : h->used;
+	live = h->used - base;
+	for (size = h->size ? h->size : READ_BUF_SIZE; size < (live + n) * 2;)
+		size *= 2;
+	arena = size == h->size ? h->arena : malloc(size);
+	if (!arena)
+		return (1);
+	for (i = 0; i < live; i++)
+		arena[i] = h->arena[base + i];
+	if (arena != h->arena)
+		free(h->arena);
+	h->arena = arena;
+	h->size = size;
+	h->used = live;
+	for (i = 0; i < (size_t)h->count; i++)
+		h->ent[(h->first + i) % HIST_MAX].off -= base;
+	return (0);
+}
+
+/**
+ * hist_push - Appends a line to the history, evicting the oldest if full.
+ *
+ * @info: The info struct holding the history.
+ * @str: The line to remember.
+ * @num: The history number of the line.
+ *
+ * The oldest line is only evicted once there is room for the new one,
+ * so a failed push leaves the history as it was.
+ *
+ * Return: 0 on success, 1 on allocation failure.
+ */
+int hist_push(info_t *info, char *str, int num)
+{
+	history_t *h = &(info->history);
+	size_t len = _strlen(str) + 1;
+	histent_t *e;
+
+	if (!h->ent)
+	{
+		h->ent = malloc(sizeof(histent_t) * HIST_MAX);
+		if (!h->ent)
+			return (1);
+	}
+	if (hist_reserve(h, len))
+		return (1);
+	if (h->count == HIST_MAX)
+	{
+		h->first = (h->first + 1) % HIST_MAX;
+		h->count--;
+	}
+	e = &(h->ent[(h->first + h->count++) % HIST_MAX]);
+	e->off = h->used;
+	e->num = num;
+	_strcpy(h->arena + h->used, str);
+	h->used += len;
+	return (0);
+}
+
+/**
+ * hist_at - Fetches a history line by position.
+ *
+ * @info: The info struct holding the history.
+ * @i: The position, 0 being the oldest line kept.
+ * @num: If not NULL, where the line's history number is stored.
+ *
+ * Return: The line, or NULL if @i is out of range.
+ */
+char *hist_at(info_t *info, int i, int *num)
+{
+	history_t *h = &(info->history);
+	histent_t *e;
+
+	if (i < 0 || i >= h->count)
+		return (NULL);
+	e = &(h->ent[(h->first + i) % HIST_MAX]);
+	if (num)
+		*num = e->num;
+	return (h->arena + e->off);
+}
+
+/**
+ * hist_clear - Forgets the whole history and releases its memory.
+ *
+ * @info: The info struct holding the history.
+ */
+void hist_clear(info_t *info)
+{
+	history_t *h = &(info->history);
+
+	free(h->ent);
+	free(h->arena);
+	_memset((void *)h, 0, sizeof(history_t));
+}
+
+/**
+ * hist_load - Loads the history file the first time history is needed.
+ *
+ * @info: The info struct holding the history.
+ *
+ * Lines entered before the load are kept and moved after the lines from
+ * the file, still unsaved, so they are numbered as if the file had been
+ * read at startup. Those a flush already saved are in the file itself,
+ * and are not kept twice.
+ *
+ * Return: The number of lines held afterwards.
+ */
+int hist_load(info_t *info)
+{
+	history_t session = info->history;
+	histent_t *e;
+	int i;
+
+	if (session.loaded)
+		return (session.count);
+	_memset((void *)&(info->history), 0, sizeof(history_t));
+	info->history.loaded = 1;
+	read_history(info);
+	info->histcount = info->history.count;
+	info->history.saved = info->histcount;
+	for (i = 0; i < session.count; i++)
+	{
+		e = &(session.ent[(session.first + i) % HIST_MAX]);
+		if (e->num < session.saved)
+			continue;
+		hist_push(info, session.arena + e->off, info->histcount++);
+	}
+	free(session.ent);
+	free(session.arena);
+	return (info->history.count);
+}
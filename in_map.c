@@ -0,0 +1,87 @@
+/*
+ * File_name: in_map.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * in_map - Maps a script file as the whole input buffer.
+ *
+ * @info: The parameter struct whose readfd is the script.
+ *
+ * Only scripts named on the command line are mapped, and only when they
+ * are regular files; pipes, FIFOs and stdin keep the streaming reader.
+ * The mapping is private and writable so lines can be terminated and
+ * lexed in place, and it is laid over an anonymous one a byte longer so
+ * a last line without a newline still has room for its terminator.
+ *
+ * Return: 1 if the script was mapped, 0 to fall back to read().
+ */
+int in_map(info_t *info)
+{
+	inbuf_t *in = &(info->in);
+	int prot = PROT_READ | PROT_WRITE;
+	struct stat st;
+	size_t len;
+	char *base;
+
+	if (info->readfd <= 2 || fstat(info->readfd, &st)
+			|| !S_ISREG(st.st_mode) || st.st_size < 1)
+		return (0);
+	len = st.st_size;
+	base = mmap(NULL, len + 1, prot, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED)
+		return (0);
+	if (mmap(base, len, prot, MAP_PRIVATE | MAP_FIXED, info->readfd, 0)
+			== MAP_FAILED)
+	{
+		munmap(base, len + 1);
+		return (0);
+	}
+	madvise(base, len, MADV_SEQUENTIAL);
+	in->buf = base;
+	in->size = in->mapped = len + 1;
+	in->end = len;
+	in->eof = 1;
+	return (1);
+}
+
+/**
+ * in_trim - Gives back the pages of a mapped script already run.
+ *
+ * @info: The parameter struct holding the input buffer.
+ * @upto: Offset of the first byte that may still be in use.
+ *
+ * Lines are written to, so every page read becomes a private copy;
+ * dropping them every MAP_TRIM_SIZE bytes keeps a huge script from
+ * staying resident as a whole.
+ */
+void in_trim(info_t *info, size_t upto)
+{
+	inbuf_t *in = &(info->in);
+	size_t page = sysconf(_SC_PAGESIZE);
+
+	upto &= ~(page - 1);
+	if (!in->mapped || upto < in->trimmed + MAP_TRIM_SIZE)
+		return;
+	madvise(in->buf + in->trimmed, upto - in->trimmed, MADV_DONTNEED);
+	in->trimmed = upto;
+}
+
+/**
+ * in_free - Releases the input buffer, mapped or not.
+ *
+ * @info: The parameter struct holding the input buffer.
+ */
+void in_free(info_t *info)
+{
+	inbuf_t *in = &(info->in);
+
+	if (in->mapped)
+		munmap(in->buf, in->mapped);
+	else
+		free(in->buf);
+	_memset((void *)in, 0, sizeof(inbuf_t));
+}
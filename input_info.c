@@ -11,6 +11,7 @@
  *
  * This function resets all fields in the provided info_t struct to their
  * initial or default values, effectively initializing the struct for use.
+ * Everything the previous command allocated from the arena is released.
  *
  * @info: A pointer to the info_t struct to be cleared.
  */
@@ -20,6 +21,7 @@ void clear_info(info_t *info)
 	info->argv = NULL;
 	info->path = NULL;
 	info->argc = 0;
+	arena_reset(&(info->arena));
 }
 
 /**
@@ -27,31 +29,51 @@ void clear_info(info_t *info)
  *
  * @info: The blank canvas (struct address) awaiting life.
  * @av: A matrix of knowledge (argument vector).
+ *
+ * argv is set up for the command's first (often only) stage.
  */
 void set_info(info_t *info, char **av)
 {
-	int i = 0;
-
 	info->fname = av[0];
 	if (info->arg)
-	{
-		info->argv = strtow(info->arg, " \t");
-		if (!info->argv)
-		{
-			info->argv = malloc(sizeof(char *) * 2);
-			if (info->argv)
-			{
-				info->argv[0] = _strdup(info->arg);
-				info->argv[1] = NULL;
-			}
-		}
-		for (i = 0; info->argv && info->argv[i]; i++)
-			;
-		info->argc = i;
+		set_argv(info, info->lex.start);
+}
 
-		replace_alias(info);
-		replace_vars(info);
-	}
+/**
+ * set_argv - Builds argv for the pipeline stage starting at a token.
+ *
+ * @info: The parameter struct holding the lexed line.
+ * @from: Index of the stage's first token.
+ *
+ * Words are already split and terminated inside the line, so argv just
+ * points at them; aliases and variables are then expanded as usual.
+ * Redirections and the words they name are left to redir_open().
+ *
+ * Return: Index of the '|' ending the stage, or lex.end for the last.
+ */
+int set_argv(info_t *info, int from)
+{
+	lex_t *lx = &(info->lex);
+	int i, j, n;
+	size_t size;
+
+	for (n = from; n < lx->end && lx->tok[n].kind != TOK_PIPE; n++)
+		;
+	size = sizeof(char *) * (n - from + 2);
+	info->argv = arena_alloc(&(info->arena), size);
+	if (!info->argv)
+		return (n);
+	for (i = 0, j = from; j < n; j++)
+		if (lx->tok[j].kind == TOK_WORD && (j == from
+					|| !IS_REDIR(lx->tok[j - 1].kind)))
+			info->argv[i++] = lx->line + lx->tok[j].off;
+	if (!i)
+		info->argv[i++] = lx->line + lx->eol;
+	info->argv[i] = NULL;
+	info->argc = i;
+	replace_alias(info);
+	replace_vars(info);
+	return (n);
 }
 
 /**
@@ -67,24 +89,30 @@ void set_info(info_t *info, char **av)
  */
 void free_info(info_t *info, int all)
 {
-	ffree(info->argv);
-	info->argv = NULL;
+	info->argv = NULL; /* lives in the arena */
 	info->path = NULL;
 	if (all)
 	{
-		if (!info->cmd_buf)
-			free(info->arg);
 		if (info->env)
 			free_list(&(info->env));
-		if (info->history)
-			free_list(&(info->history));
+		info->env_tail = NULL;
+		bfree((void **)&(info->env_idx.slots));
+		info->env_idx.size = info->env_idx.used = 0;
+		info->env_idx.live = 0;
+		hist_clear(info);
+		arena_free(&(info->arena));
+		bfree((void **)&(info->lex.tok));
+		bfree((void **)&(info->lex.copy));
 		if (info->alias)
 			free_list(&(info->alias));
-		ffree(info->environ);
-			info->environ = NULL;
-		bfree((void **)info->cmd_buf);
+		hash_drop(info, NULL);
+		while (info->jobs)
+			job_drop(info, info->jobs);
+		bfree((void **)&(info->pipestatus));
+		bfree((void **)&(info->environ)); /* strings belong to env */
+		in_free(info); /* the lines live here */
 		if (info->readfd > 2)
 			close(info->readfd);
-		_putchar(BUF_FLUSH);
+		w_flush(-1);
 	}
 }
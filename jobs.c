@@ -0,0 +1,155 @@
+/*
+ * File_name: jobs.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * job_text - Spells out the current command for the job table.
+ *
+ * @info: The parameter struct holding the lexed line.
+ *
+ * Return: The command's words, pipes and redirections joined by spaces,
+ *         in a new string, or NULL if it cannot be allocated.
+ */
+static char *job_text(info_t *info)
+{
+	static char *ops[] = {"<", ">", ">>", "<>", "<&", ">&", "<<", "<<-",
+		"<<<"};
+	lex_t *lx = &(info->lex);
+	size_t size = 1;
+	token_t *t;
+	char *cmd;
+	int i;
+
+	for (i = lx->start; i < lx->end; i++)
+		size += lx->tok[i].len + 4;
+	cmd = calloc(size, 1);
+	for (i = lx->start; cmd && i < lx->end; i++)
+	{
+		t = &(lx->tok[i]);
+		if (i > lx->start && !IS_REDIR(t[-1].kind))
+			_strcat(cmd, " ");
+		if (t->kind == TOK_WORD)
+			_strcat(cmd, lx->line + t->off);
+		else if (t->kind == TOK_PIPE)
+			_strcat(cmd, "|");
+		else
+		{
+			if (lx->line[t->off] >= '0' && lx->line[t->off] <= '9')
+				_strncat(cmd, lx->line + t->off, t->len);
+			_strcat(cmd, ops[t->kind - TOK_LESS]);
+		}
+	}
+	return (cmd);
+}
+
+/**
+ * job_add - Records a command just started in the background.
+ *
+ * @info: The parameter struct holding the lexed line.
+ * @s: The command's stages, as run_pipeline() started them.
+ * @n: The number of stages.
+ *
+ * The job takes the lowest number above every job still listed, and
+ * the pid of its last stage becomes $!. An interactive shell announces
+ * it as [n] pid.
+ *
+ * Return: 0 on success, 1 if nothing was started or on allocation
+ *         failure.
+ */
+int job_add(info_t *info, stage_t *s, int n)
+{
+	job_t *job = malloc(sizeof(job_t) + sizeof(pid_t) * n), **tail;
+	int i, id = 1;
+
+	if (!job)
+		return (1);
+	job->pid = (pid_t *)(job + 1);
+	job->n = n, job->live = 0, job->status = n ? s[n - 1].status : 0;
+	for (i = 0; i < n; i++)
+	{
+		job->pid[i] = s[i].pid > 0 ? s[i].pid : 0;
+		job->live += s[i].pid > 0;
+		if (s[i].pid > 0)
+			info->last_bg = s[i].pid;
+	}
+	if (!job->live)
+		return (free(job), 1);
+	job->cmd = job_text(info);
+	for (tail = &(info->jobs); *tail; tail = &((*tail)->next))
+		id = (*tail)->id + 1;
+	job->id = id, job->next = NULL, *tail = job;
+	if (interactive(info))
+	{
+		_putchar('['), print_d(id, STDOUT_FILENO), _puts("] ");
+		print_d(info->last_bg, STDOUT_FILENO), _putchar('\n');
+	}
+	return (0);
+}
+
+/**
+ * job_note - Records that a background process has been reaped.
+ *
+ * @info: The parameter struct holding the job table.
+ * @pid: The process.
+ * @w: Its wait status.
+ *
+ * The stage's pid is negated; a job is finished once none is left.
+ *
+ * Return: The job if this finished it, NULL otherwise (including for a
+ *         process that is not part of any job).
+ */
+job_t *job_note(info_t *info, pid_t pid, int w)
+{
+	job_t *job;
+	int i = 0;
+
+	for (job = info->jobs; job; job = job->next)
+	{
+		for (i = 0; i < job->n && job->pid[i] != pid; i++)
+			;
+		if (i < job->n)
+			break;
+	}
+	if (!job)
+		return (NULL);
+	job->pid[i] = -pid;
+	if (i == job->n - 1)
+		job->status = WIFEXITED(w) ? WEXITSTATUS(w) : 128 + WTERMSIG(w);
+	return (--job->live ? NULL : job);
+}
+
+/**
+ * jobs_reap - Collects the background processes that have exited.
+ *
+ * @info: The parameter struct holding the job table.
+ * @block: 0 to return at once if nothing has exited, as between
+ *         commands; 1 to wait until some job has finished.
+ *
+ * Without @block nothing is done unless ev_signals() has seen SIGCHLD
+ * since the last look, so a shell with idle jobs makes no extra system
+ * calls. Without the signalfd every look polls. The jobs finished are
+ * left for jobs_report() to list and forget.
+ *
+ * Return: The last job this call finished, or NULL if none did.
+ */
+job_t *jobs_reap(info_t *info, int block)
+{
+	job_t *job, *done = NULL;
+	pid_t pid;
+	int w;
+
+	if (!info->jobs || (!block && !info->ev.chld && info->ev.sig != -1))
+		return (NULL);
+	info->ev.chld = 0;
+	while ((pid = waitpid(-1, &w, block && !done ? 0 : WNOHANG)) > 0)
+	{
+		job = job_note(info, pid, w);
+		if (job)
+			done = job;
+	}
+	return (done);
+}
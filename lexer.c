@@ -0,0 +1,242 @@
+/*
+ * File_name: lexer.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/* byte classes, indexed by (unsigned char); everything above '|' is 0 */
+static const unsigned char char_class[256] = {
+	/* NUL ... SI: '\0' ends the line, '\t' and '\n' are blanks */
+	CH_END, 0, 0, 0, 0, 0, 0, 0, 0, CH_BLANK, CH_BLANK, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* ' ' ! " # $ % & ' ( ) * + , - . / */
+	CH_BLANK, 0, CH_QUOTE, CH_HASH, 0, 0, CH_OP, CH_QUOTE,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	/* 0 ... 9 : ; < = > ? */
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, CH_OP, CH_OP, 0, CH_OP, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* p ... z { | */
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, CH_OP
+};
+
+/**
+ * lex_op - Recognises the operator at the start of a string.
+ *
+ * @s: The string.
+ * @len: Where the operator's length is stored.
+ *
+ * Return: CMD_CHAIN, CMD_AND, CMD_OR, CMD_BG, TOK_PIPE or one of the
+ *         TOK_ redirections, or 0 if @s does not start with an operator.
+ */
+static int lex_op(char *s, size_t *len)
+{
+	*len = 1;
+	if (*s == ';')
+		return (CMD_CHAIN);
+	*len = 2;
+	if (s[0] == '&' && s[1] == '&')
+		return (CMD_AND);
+	if (s[0] == '|' && s[1] == '|')
+		return (CMD_OR);
+	if (s[0] == '<' && s[1] == '<')
+	{
+		*len += s[2] == '<' || s[2] == '-';
+		return (s[2] == '<' ? TOK_TLESS
+				: s[2] == '-' ? TOK_DLESSDASH : TOK_DLESS);
+	}
+	if (s[0] == '<' && (s[1] == '>' || s[1] == '&'))
+		return (s[1] == '>' ? TOK_LESSGREAT : TOK_LESSAND);
+	if (s[0] == '>' && (s[1] == '>' || s[1] == '&'))
+		return (s[1] == '>' ? TOK_DGREAT : TOK_GREATAND);
+	*len = 1;
+	if (*s == '&')
+		return (CMD_BG);
+	if (*s == '<' || *s == '>')
+		return (*s == '<' ? TOK_LESS : TOK_GREAT);
+	return (*s == '|' ? TOK_PIPE : 0);
+}
+
+/**
+ * lex_push - Appends a token span to the line's token list.
+ *
+ * @lx: The lexer state.
+ * @kind: TOK_WORD, TOK_PIPE, a TOK_ redirection or one of the CMD_
+ *        operator types.
+ * @off: Offset of the token in the line.
+ * @len: Length of the token.
+ *
+ * The list is grown geometrically and reused from line to line. An
+ * unquoted run of digits right before a redirection, as in 2>, is its
+ * fd number: that word becomes the redirection's span.
+ *
+ * Return: 0 on success, 1 on allocation failure.
+ */
+static int lex_push(lex_t *lx, int kind, size_t off, size_t len)
+{
+	token_t *tok = lx->count ? &(lx->tok[lx->count - 1]) : NULL;
+	unsigned int size = sizeof(token_t) * (lx->cap ? lx->cap : 32);
+	size_t i;
+
+	lx->docs += kind == TOK_DLESS || kind == TOK_DLESSDASH;
+	if (IS_REDIR(kind) && tok && tok->kind == TOK_WORD
+			&& tok->off + tok->len == off)
+	{
+		for (i = tok->off; i < off && lx->line[i] >= '0'
+				&& lx->line[i] <= '9'; i++)
+			;
+		if (i == off)
+			return (tok->kind = kind, 0);
+	}
+	if (lx->count == lx->cap)
+	{
+		tok = _realloc(lx->tok, lx->cap ? size : 0, size * 2);
+		if (!tok)
+			return (1);
+		lx->tok = tok;
+		lx->cap = size * 2 / sizeof(token_t);
+	}
+	lx->tok[lx->count].kind = kind;
+	lx->tok[lx->count].fd = -1;
+	lx->tok[lx->count].off = off;
+	lx->tok[lx->count++].len = len;
+	return (0);
+}
+
+/**
+ * lex_word - Scans one word, removing its quotes in place.
+ *
+ * @buf: The line.
+ * @i: Index of the word's first byte; advanced past the word.
+ *
+ * A quoted stretch runs to the matching quote (or the end of the line)
+ * and may hold blanks and operators.
+ *
+ * Return: The length of the word once its quotes are removed.
+ */
+static size_t lex_word(char *buf, size_t *i)
+{
+	size_t r = *i, w = *i, len;
+	unsigned char cls;
+	char q;
+
+	while (1)
+	{
+		cls = char_class[(unsigned char)buf[r]];
+		if (cls & (CH_BLANK | CH_END))
+			break;
+		if (cls & CH_OP && lex_op(buf + r, &len))
+			break;
+		if (!(cls & CH_QUOTE))
+		{
+			buf[w++] = buf[r++];
+			continue;
+		}
+		q = buf[r++];
+		while (buf[r] && buf[r] != q)
+			buf[w++] = buf[r++];
+		if (buf[r])
+			r++;
+	}
+	len = w - *i;
+	*i = r;
+	return (len);
+}
+
+/**
+ * lex_line - Splits a line into word and operator spans in one pass.
+ *
+ * @info: The parameter struct holding the lexer state.
+ * @buf: The line; quotes are removed from words in place and every word
+ *       is NUL-terminated where it ends, so words can be used directly.
+ *
+ * Each byte is classified once through char_class. A '#' starting a
+ * word comments out the rest of the line. If the token list cannot
+ * grow, the line is dropped by lex_drop() rather than run short.
+ *
+ * Return: The number of tokens, or -1 if the line was dropped.
+ */
+int lex_line(info_t *info, char *buf)
+{
+	lex_t *lx = &(info->lex);
+	size_t i = 0, start, len;
+	unsigned char cls;
+	int kind;
+
+	lx->line = buf;
+	lx->count = lx->pos = lx->docs = 0;
+	for (cls = char_class[(unsigned char)buf[0]];
+			!(cls & (CH_END | CH_HASH));
+			cls = char_class[(unsigned char)buf[i]])
+	{
+		if (cls & CH_BLANK)
+		{
+			i++;
+			continue;
+		}
+		kind = cls & CH_OP ? lex_op(buf + i, &len) : 0;
+		start = i;
+		if (kind)
+			i += len;
+		else
+			len = lex_word(buf, &i);
+		if (lex_push(lx, kind ? kind : TOK_WORD, start, len))
+			return (lex_drop(info, "out of memory\n"), -1);
+	}
+	buf[i] = 0; /* drop any comment */
+	lx->eol = i;
+	for (kind = 0; kind < lx->count; kind++)
+		if (lx->tok[kind].kind == TOK_WORD)
+			buf[lx->tok[kind].off + lx->tok[kind].len] = 0;
+	return (lx->count);
+}
+
+/**
+ * lex_next - Selects the next command of the line to run.
+ *
+ * @info: The parameter struct holding the lexer state.
+ *
+ * The command's tokens are [start, end): its words, its redirections
+ * and the '|' of a pipeline, counted in lx->redirs and lx->pipes. A
+ * command after && is skipped while the last status is failure, and one
+ * after || while it is success, leaving the status alone so the next
+ * operator sees it too. A command ending in '&' sets lx->bg and lets
+ * the next one run regardless. info->arg is left pointing at the first
+ * word, or at an empty string when there is nothing to run.
+ *
+ * Return: 1 if the line has more commands after this one, 0 otherwise.
+ */
+int lex_next(info_t *info)
+{
+	lex_t *lx = &(info->lex);
+	int type, skip;
+
+	do {
+		type = info->cmd_buf_type;
+		lx->start = lx->pos;
+		for (lx->pipes = lx->redirs = 0; lx->pos < lx->count
+				&& lx->tok[lx->pos].kind >= TOK_WORD; lx->pos++)
+		{
+			lx->pipes += lx->tok[lx->pos].kind == TOK_PIPE;
+			lx->redirs += IS_REDIR(lx->tok[lx->pos].kind);
+		}
+		lx->end = lx->pos;
+		info->cmd_buf_type = CMD_NORM;
+		if (lx->pos < lx->count)
+			info->cmd_buf_type = lx->tok[lx->pos++].kind;
+		lx->bg = info->cmd_buf_type == CMD_BG;
+		skip = (type == CMD_AND && info->status)
+			|| (type == CMD_OR && !info->status);
+		if (skip)
+		{
+			lx->end = lx->start;
+			lx->pipes = lx->redirs = lx->bg = 0;
+		}
+	} while (skip && lx->pos < lx->count);
+	info->arg = lx->line + (lx->start < lx->end
+			? lx->tok[lx->start].off : lx->eol);
+	return (lx->pos < lx->count);
+}
@@ -108,3 +108,76 @@ char *find_path(info_t *info, char *pathstr, char *cmd)
 	}
 	return (NULL);
 }
+
+/**
+ * path_mtime - Finds the freshest modification time among PATH directories.
+ *
+ * @pathstr: The PATH string to walk.
+ * @ts: Where the newest directory modification time is stored, or NULL
+ *      to only check PATH for relative entries without touching the disk.
+ *
+ * A relative PATH entry (empty, "." or not starting with '/') depends on
+ * the current directory, so its answers cannot be remembered across a cd.
+ *
+ * Return: The number of directories examined, or -1 if PATH has a
+ *         relative entry.
+ */
+int path_mtime(char *pathstr, struct timespec *ts)
+{
+	int i = 0, curr_pos = 0, n = 0;
+	char *dir;
+	struct stat st;
+
+	if (ts)
+		ts->tv_sec = ts->tv_nsec = 0;
+	if (!pathstr)
+		return (0);
+	while (1)
+	{
+		if (!pathstr[i] || pathstr[i] == ':')
+		{
+			dir = dup_chars(pathstr, curr_pos, i);
+			if (*dir != '/')
+				return (-1);
+			if (ts && !stat(dir, &st) && TS_AFTER(st.st_mtim, *ts))
+				*ts = st.st_mtim;
+			n++;
+			if (!pathstr[i])
+				break;
+			curr_pos = i;
+		}
+		i++;
+	}
+	return (n);
+}
+
+/**
+ * locate_cmd - Resolves a command through the session's command hash.
+ *
+ * @info: The info struct holding the command hash.
+ * @cmd: The command to resolve.
+ *
+ * Names containing a slash, and lookups under a PATH with relative
+ * entries, go straight to find_path(). Everything else is answered from
+ * the hash when possible, and the outcome of a fresh search (found or
+ * not) is remembered for the next time.
+ *
+ * Return: The full path of the command, or NULL if it is not on PATH.
+ */
+char *locate_cmd(info_t *info, char *cmd)
+{
+	char *pathstr = _getenv(info, "PATH="), *path;
+	cmdhash_t *entry;
+
+	if (!pathstr || _strchr(cmd, '/') || path_mtime(pathstr, NULL) < 0)
+		return (find_path(info, pathstr, cmd));
+	entry = hash_find(info, cmd);
+	if (entry)
+	{
+		entry->hits++;
+		return (entry->path);
+	}
+	path = find_path(info, pathstr, cmd);
+	entry = hash_add(info, cmd, path);
+	return (entry ? entry->path : path);
+}
@@ -16,6 +16,12 @@
  * user commands and executes them, returning success (0) or error (1).
  * In case of error, an error code is returned.
  *
+ * The history file is only read once an interactive prompt or the
+ * history builtin needs it, and only interactive shells save to it
+ * unless HISTSAVE is set in the environment. With HISTFLUSH set, new
+ * history lines are saved after every command, which leaves nothing to
+ * do at exit.
+ *
  * Return: 0 on success, 1 on error, or error code.
  */
 int hsh(info_t *info, char **av)
@@ -26,8 +32,13 @@ int hsh(info_t *info, char **av)
 	while (r != -1 && builtin_ret != -2)
 	{
 		clear_info(info);
+		ev_signals(info, 0);
+		jobs_reap(info, 0);
 		if (interactive(info))
+		{
+			jobs_report(info, 0), hist_load(info);
 			_puts("$ ");
+		}
 		_eputchar(BUF_FLUSH);
 		r = get_input(info);
 		if (r != -1)
@@ -36,12 +47,15 @@ int hsh(info_t *info, char **av)
 			builtin_ret = find_builtin(info);
 			if (builtin_ret == -1)
 				find_cmd(info);
+			if (_getenv(info, "HISTFLUSH="))
+				write_history(info);
 		}
 		else if (interactive(info))
 			_putchar('\n');
 		free_info(info, 0);
 	}
-	write_history(info);
+	if (interactive(info) || _getenv(info, "HISTSAVE="))
+		write_history(info);
 	free_info(info, 1);
 	if (!interactive(info) && info->status)
 		exit(info->status);
@@ -64,35 +78,75 @@ int hsh(info_t *info, char **av)
  * command and handle it accordingly. The return values indicate the
  * outcome: -1 for not found, 0 for successful execution, 1 for found
  * but unsuccessful execution, and 2 for a built-in signaling exit().
+ * A pipeline or a command ending in '&' is run as a whole by
+ * run_pipeline() and reported as found, and a command with
+ * redirections is run by redir_run().
  *
  * Return: -1 if built-in not found, 0 if successful execution,
  *         1 if found but unsuccessful, 2 if built-in signals exit().
  */
 int find_builtin(info_t *info)
 {
-	int i, built_in_ret = -1;
-	builtin_table builtintbl[] = {
-		{"exit", _myexit},
-		{"env", _myenv},
-		{"help", _myhelp},
-		{"history", _myhistory},
-		{"setenv", _mysetenv},
-		{"unsetenv", _myunsetenv},
-		{"cd", _mycd},
-		{"alias", _myalias},
-		{NULL, NULL}
-	};
+	int built_in_ret = -1;
+	builtin_table *builtin;
 
-	for (i = 0; builtintbl[i].type; i++)
-		if (_strcmp(info->argv[0], builtintbl[i].type) == 0)
-		{
-			info->line_count++;
-			built_in_ret = builtintbl[i].func(info);
-			break;
-		}
+	if (info->lex.pipes || info->lex.bg) /* stage by stage */
+		return (run_pipeline(info) ? 1 : 0);
+	if (info->lex.redirs)
+		return (redir_run(info));
+	builtin = builtin_lookup(info->argv[0]);
+	if (builtin)
+	{
+		info->line_count++;
+		built_in_ret = builtin->func(info);
+	}
 	return (built_in_ret);
 }
 
+#define BUILTIN_ID(name, c0, c1, func, inproc) BI_##func,
+#define BUILTIN_ENTRY(name, c0, c1, func, inproc) {name, func, inproc},
+#define BUILTIN_CASE(name, c0, c1, func, inproc) \
+	case BUILTIN_KEY(sizeof(name) - 1, c0, c1): \
+		i = BI_##func; \
+		break;
+
+enum builtin_id
+{
+	BUILTINS(BUILTIN_ID) BI_NONE
+};
+
+/**
+ * builtin_lookup - Finds the table entry for a built-in command.
+ *
+ * @name: The command name.
+ *
+ * The table and the switch are both expanded from BUILTINS(), so the
+ * key of @name picks its only candidate without scanning the table.
+ *
+ * Return: The matching builtin_table entry, or NULL if @name is not
+ *         a built-in.
+ */
+builtin_table *builtin_lookup(char *name)
+{
+	static builtin_table builtintbl[] = {
+		BUILTINS(BUILTIN_ENTRY)
+		{NULL, NULL, 0}
+	};
+	int i = BI_NONE;
+
+	if (!name || !*name)
+		return (NULL);
+	switch (BUILTIN_KEY(_strlen(name), name[0], name[1]))
+	{
+		BUILTINS(BUILTIN_CASE)
+	default:
+		break;
+	}
+	if (i == BI_NONE || _strcmp(name, builtintbl[i].type))
+		return (NULL);
+	return (&builtintbl[i]);
+}
+
 /**
  * find_cmd - Scours the PATH to locate a command.
  *
@@ -121,7 +175,7 @@ void find_cmd(info_t *info)
 	if (!k)
 		return;
 
-	path = find_path(info, _getenv(info, "PATH="), info->argv[0]);
+	path = locate_cmd(info, info->argv[0]);
 	if (path)
 	{
 		info->path = path;
@@ -148,40 +202,39 @@ void find_cmd(info_t *info)
  * This function forks a new execution thread to run the specified
  * command using the information provided in the 'info' structure.
  * It handles the creation and execution of the child process,
- * allowing the parent thread to continue its operation.
+ * allowing the parent thread to continue its operation. When
+ * info->async_pid is set the child is left running and its pid stored
+ * there, for the caller to wait on.
  *
  * Return: This function returns void.
  */
 void fork_cmd(info_t *info)
 {
 	pid_t child_pid;
+	int err;
 
-	child_pid = fork();
-	if (child_pid == -1)
+	err = spawn_cmd(info, &child_pid);
+	if (err == EAGAIN || err == ENOMEM)
 	{
 		/* TODO: PUT ERROR FUNCTION */
+		errno = err;
 		perror("Error:");
 		return;
 	}
-	if (child_pid == 0)
+	if (err) /* the exec itself failed; report it as the child would */
+		info->status = err == EACCES ? 126 : 1;
+	else if (info->async_pid)
 	{
-		if (execve(info->path, info->argv, get_environ(info)) == -1)
-		{
-			free_info(info, 1);
-			if (errno == EACCES)
-				exit(126);
-			exit(1);
-		}
-		/* TODO: PUT ERROR FUNCTION */
+		*(info->async_pid) = child_pid;
+		return;
 	}
 	else
 	{
-		wait(&(info->status));
-		if (WIFEXITED(info->status))
-		{
-			info->status = WEXITSTATUS(info->status);
-			if (info->status == 126)
-				print_error(info, "Permission denied\n");
-		}
+		waitpid(child_pid, &(info->status), 0);
+		if (!WIFEXITED(info->status))
+			return;
+		info->status = WEXITSTATUS(info->status);
 	}
+	if (info->status == 126)
+		print_error(info, "Permission denied\n");
 }
@@ -48,8 +48,11 @@ int main(int ac, char **av)
 		}
 		info->readfd = fd;
 	}
+	info->fname = av[0]; /* for errors found before the first command */
+	info->is_tty = isatty(STDIN_FILENO) && info->readfd <= 2;
+	signal(SIGINT, sigintHandler);
+	ev_init(info);
 	populate_env_list(info);
-	read_history(info);
 	hsh(info, av);
 	return (EXIT_SUCCESS);
 }
@@ -6,91 +6,6 @@
 
 #include "shell.h"
 
-/**
- * is_chain - Dances through the buffer,
- * seeking the rhythm of chain delimiters.
- *
- * @info: The conductor guiding this char-melody.
- * @buf: The musical notes (characters) to be played.
- * @p: The current note's sheet music position.
- *
- * This enchanting function, with the guidance of 'info,'
- * delicately checks if the
- * character at the given 'p' in 'buf'
- * plays the harmonious role of a chain delimiter.
- * It returns 1 if the character is in tune with the chain,
- * or 0 if it's out of sync.
- *
- * Return: 1 if the character dances as a chain delimiter, 0 otherwise.
- */
-int is_chain(info_t *info, char *buf, size_t *p)
-{
-	size_t j = *p;
-
-	if (buf[j] == '|' && buf[j + 1] == '|')
-	{
-		buf[j] = 0;
-		j++;
-		info->cmd_buf_type = CMD_OR;
-	}
-	else if (buf[j] == '&' && buf[j + 1] == '&')
-	{
-		buf[j] = 0;
-		j++;
-		info->cmd_buf_type = CMD_AND;
-	}
-	else if (buf[j] == ';') /* found end of this command */
-	{
-		buf[j] = 0; /* replace semicolon with null */
-		info->cmd_buf_type = CMD_CHAIN;
-	}
-	else
-		return (0);
-	*p = j;
-	return (1);
-}
-
-/**
- * check_chain - Evaluates whether to continue
- * chaining based on prior status.
- *
- * @info: Pointer to the parameter struct.
- * @buf: Character buffer.
- * @p: Address of the current position in buf.
- * @i: Starting position in buf.
- * @len: Length of buf.
- *
- * This function assesses whether to proceed with chaining based on the
- * previous status, as indicated in the parameter struct. It operates on
- * the provided character buffer and current position, starting from 'i,'
- * and the total length 'len.'
- *
- * Return: Void.
- */
-void check_chain(info_t *info, char *buf, size_t *p, size_t i, size_t len)
-{
-	size_t j = *p;
-
-	if (info->cmd_buf_type == CMD_AND)
-	{
-		if (info->status)
-		{
-			buf[i] = 0;
-			j = len;
-		}
-	}
-	if (info->cmd_buf_type == CMD_OR)
-	{
-		if (!info->status)
-		{
-			buf[i] = 0;
-			j = len;
-		}
-	}
-
-	*p = j;
-}
-
 /**
  * replace_alias - Harmonizes tokenized string with defined aliases.
  *
@@ -113,11 +28,10 @@ int replace_alias(info_t *info)
 		node = node_starts_with(info->alias, info->argv[0], '=');
 		if (!node)
 			return (0);
-		free(info->argv[0]);
 		p = _strchr(node->str, '=');
 		if (!p)
 			return (0);
-		p = _strdup(p + 1);
+		p = arena_strdup(&(info->arena), p + 1);
 		if (!p)
 			return (0);
 		info->argv[0] = p;
@@ -141,6 +55,9 @@ int replace_vars(info_t *info)
 {
 	int i = 0;
 	list_t *node;
+	arena_t *a = &(info->arena);
+	pid_t pid;
+	char *p;
 
 	for (i = 0; info->argv[i]; i++)
 	{
@@ -150,23 +67,24 @@ int replace_vars(info_t *info)
 		if (!_strcmp(info->argv[i], "$?"))
 		{
 			replace_string(&(info->argv[i]),
-					_strdup(convert_number(info->status, 10, 0)));
+					arena_strdup(a, convert_number(info->status, 10, 0)));
 			continue;
 		}
-		if (!_strcmp(info->argv[i], "$$"))
+		if (!_strcmp(info->argv[i], "$$")
+				|| !_strcmp(info->argv[i], "$!"))
 		{
-			replace_string(&(info->argv[i]),
-					_strdup(convert_number(getpid(), 10, 0)));
+			pid = info->argv[i][1] == '$' ? getpid()
+				: info->last_bg;
+			p = pid ? convert_number(pid, 10, 0) : ""; /* no job */
+			replace_string(&(info->argv[i]), arena_strdup(a, p));
 			continue;
 		}
-		node = node_starts_with(info->env, &info->argv[i][1], '=');
+		p = !_strcmp(info->argv[i], "$PIPESTATUS") ? info->pipestatus
+			: NULL;
+		node = p ? NULL : env_lookup(info, &info->argv[i][1]);
 		if (node)
-		{
-			replace_string(&(info->argv[i]),
-					_strdup(_strchr(node->str, '=') + 1));
-			continue;
-		}
-		replace_string(&info->argv[i], _strdup(""));
+			p = _strchr(node->str, '=') + 1;
+		replace_string(&info->argv[i], arena_strdup(a, p ? p : ""));
 
 	}
 	return (0);
@@ -186,7 +104,8 @@ int replace_vars(info_t *info)
  */
 int replace_string(char **old, char *new)
 {
-	free(*old);
-	*old = new;
+	if (!new)
+		return (0);
+	*old = new; /* the old string lives in the arena */
 	return (1);
 }
@@ -0,0 +1,123 @@
+/*
+ * File_name: pipeline.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * pipe_check - Rejects a pipeline with an empty stage.
+ *
+ * @info: The parameter struct holding the lexed line.
+ *
+ * Return: 0 if every stage has a word, 1 (after reporting a syntax
+ *         error) otherwise.
+ */
+static int pipe_check(info_t *info)
+{
+	lex_t *lx = &(info->lex);
+	int i;
+
+	for (i = lx->start; i < lx->end; i++)
+		if (lx->tok[i].kind == TOK_PIPE && (i == lx->start
+					|| i == lx->end - 1
+					|| lx->tok[i + 1].kind == TOK_PIPE))
+		{
+			_eputs(info->fname);
+			_eputs(": ");
+			print_d(info->line_count, STDERR_FILENO);
+			_eputs(": Syntax error: \"|\" unexpected\n");
+			info->status = 2;
+			return (1);
+		}
+	return (0);
+}
+
+/**
+ * pipe_open - Creates the pipe between two stages.
+ *
+ * @info: The parameter struct.
+ * @s: The first stage; its out gets the write end, and the in of the
+ *     stage after it the read end.
+ *
+ * Both ends are close-on-exec, so a stage only keeps the ends moved
+ * onto its stdin and stdout. If PIPESIZE is set to a byte count, the
+ * pipe's capacity is raised to it with F_SETPIPE_SZ; the kernel caps
+ * it at /proc/sys/fs/pipe-max-size for unprivileged users.
+ *
+ * Return: 0 on success, -1 on failure.
+ */
+static int pipe_open(info_t *info, stage_t *s)
+{
+	char *size = _getenv(info, "PIPESIZE=");
+	long n;
+	int p[2];
+
+	if (pipe2(p, O_CLOEXEC) == -1)
+	{
+		perror("pipe");
+		return (-1);
+	}
+	if (size && !_atol(size, &n) && n > 0 && n <= INT_MAX)
+		fcntl(p[1], F_SETPIPE_SZ, (int)n);
+	s[0].out = p[1], s[1].in = p[0];
+	return (0);
+}
+
+/**
+ * run_pipeline - Runs cmd | cmd | ... with every stage at once.
+ *
+ * @info: The parameter struct holding the lexed line.
+ *
+ * Each stage is started before the next, joined to it by a pipe, and
+ * only then are they all waited on, so no stage's output is held back.
+ * A builtin that changes the shell runs in a forked copy of it; one
+ * that only prints, such as env or history, runs in the shell itself
+ * once the stages after it are going, writing straight into its pipe.
+ * A command ending in '&' is left running as a job, reading /dev/null
+ * unless redirected and ignoring SIGINT, with status 0.
+ *
+ * Return: The pipeline's status.
+ */
+int run_pipeline(info_t *info)
+{
+	lex_t *lx = &(info->lex);
+	int n = lx->pipes + 1, i, j, tok = lx->start, in = -1;
+	stage_t *s;
+
+	if (info->linecount_flag)
+		info->line_count++, info->linecount_flag = 0;
+	if (pipe_check(info))
+		return (info->status);
+	s = arena_alloc(&(info->arena), sizeof(stage_t) * n);
+	if (!s)
+		return (info->status = 1);
+	if (lx->bg) /* no job control: keep it off the terminal and ^C */
+		in = open("/dev/null", O_RDONLY | O_CLOEXEC),
+			signal(SIGINT, SIG_IGN);
+	for (i = 0; i < n; i++, tok++)
+	{
+		s[i].tok = tok, s[i].in = in, s[i].out = -1;
+		if (i < n - 1 && pipe_open(info, &s[i]))
+			break;
+		tok = stage_start(info, s, i);
+		if (in != -1)
+			close(in);
+		if (s[i].out != -1 && s[i].pid != -1)
+			close(s[i].out);
+		in = i < n - 1 ? s[i + 1].in : -1;
+	}
+	if (in != -1)
+		close(in);
+	if (lx->bg)
+		return (signal(SIGINT, sigintHandler), job_add(info, s, i),
+				info->status = 0);
+	for (j = 0; j < i; j++)
+		if (s[j].pid == -1)
+			stage_run(info, &s[j]);
+	stage_wait(info, s, i);
+	if (i < n) /* a pipe could not be made */
+		info->status = 1;
+	return (info->status);
+}
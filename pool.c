@@ -0,0 +1,208 @@
+/*
+ * File_name: pool.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * pool_init - Sets up a pool of command slots.
+ *
+ * @info: The parameter struct whose arena holds the slots.
+ * @p: The pool.
+ * @max: The number of slots; 0 or less for one per online CPU.
+ * @n: How many commands it will run; there are never more slots, so a
+ *     huge @max costs nothing.
+ *
+ * Return: 0 on success, 1 on allocation failure.
+ */
+int pool_init(info_t *info, pool_t *p, long max, int n)
+{
+	if (max < 1)
+		max = sysconf(_SC_NPROCESSORS_ONLN);
+	if (max > n)
+		max = n;
+	p->max = max < 1 ? 1 : max;
+	p->running = 0;
+	p->pid = arena_alloc(&(info->arena), sizeof(pid_t) * p->max);
+	p->tag = arena_alloc(&(info->arena), sizeof(int) * p->max);
+	if (!p->pid || !p->tag)
+		return (1);
+	_memset((char *)p->pid, 0, sizeof(pid_t) * p->max);
+	return (0);
+}
+
+/**
+ * pool_start - Starts a command in a free slot of a pool.
+ *
+ * @info: The parameter struct; info->fds holds the moves the command
+ *        should get, on top of those of the builtin running it.
+ * @p: The pool; it must have a free slot.
+ * @argv: The command, NULL-terminated.
+ * @tag: What to call it when pool_wait() reports it finished.
+ *
+ * The command goes through find_cmd(), so it is looked up in the
+ * command hash and spawned exactly as if it had been typed.
+ *
+ * Return: 0 if it was started, -1 if not (info->status says why).
+ */
+int pool_start(info_t *info, pool_t *p, char **argv, int tag)
+{
+	char **av = info->argv;
+	int ac = info->argc, i;
+	pid_t pid = 0;
+
+	for (i = 0; p->pid[i]; i++)
+		;
+	info->argv = argv;
+	for (info->argc = 0; argv[info->argc]; info->argc++)
+		;
+	info->linecount_flag = 0; /* counted when the builtin ran */
+	info->async_pid = &pid;
+	find_cmd(info);
+	info->async_pid = NULL;
+	info->argv = av, info->argc = ac;
+	if (!pid)
+		return (-1);
+	p->pid[i] = pid, p->tag[i] = tag, p->running++;
+	return (0);
+}
+
+/**
+ * pool_wait - Waits for one command of a pool to finish.
+ *
+ * @info: The parameter struct holding the job table.
+ * @p: The pool.
+ * @status: Where its exit status (128 + signal if killed) is stored.
+ *
+ * A background job's process reaped meanwhile is handed to job_note().
+ *
+ * Return: The command's tag, or -1 if none is running.
+ */
+int pool_wait(info_t *info, pool_t *p, int *status)
+{
+	pid_t pid;
+	int w, i;
+
+	while (p->running)
+	{
+		pid = waitpid(-1, &w, 0);
+		if (pid == -1 && errno == EINTR)
+			continue;
+		if (pid == -1)
+			break;
+		for (i = 0; i < p->max && p->pid[i] != pid; i++)
+			;
+		if (i == p->max)
+		{
+			job_note(info, pid, w);
+			continue;
+		}
+		p->pid[i] = 0, p->running--;
+		*status = WIFEXITED(w) ? WEXITSTATUS(w) : 128 + WTERMSIG(w);
+		return (p->tag[i]);
+	}
+	return (-1);
+}
+
+/**
+ * item_argv - Builds the command line for one item of a list.
+ *
+ * @info: The parameter struct whose arena holds the result.
+ * @tmpl: The command, NULL-terminated.
+ * @item: The item.
+ *
+ * Every {} in a word is replaced by @item; if no word has one, @item is
+ * added as a last argument instead.
+ *
+ * Return: The new argv, or NULL on allocation failure.
+ */
+char **item_argv(info_t *info, char **tmpl, char *item)
+{
+	size_t len = _strlen(item), k;
+	char **av, *p, *w;
+	int n, i, has = 0;
+
+	for (n = 0; tmpl[n]; n++)
+		;
+	av = arena_alloc(&(info->arena), sizeof(char *) * (n + 2));
+	for (i = 0; av && i < n; i++)
+	{
+		for (k = 0, p = tmpl[i]; (p = _strchr(p, '{')); p++)
+			k += p[1] == '}';
+		av[i] = tmpl[i];
+		if (!k)
+			continue;
+		has = 1;
+		av[i] = w = arena_alloc(&(info->arena),
+				_strlen(tmpl[i]) + k * len + 1);
+		for (p = tmpl[i]; w && *p; p++)
+			if (p[0] == '{' && p[1] == '}')
+				memcpy(w, item, len), w += len, p++;
+			else
+				*w++ = *p;
+		if (!w)
+			return (NULL);
+		*w = '\0';
+	}
+	if (av)
+		av[n] = has ? NULL : item, av[n + 1] = NULL;
+	return (av);
+}
+
+/**
+ * read_items - Reads a builtin's input as a list of items, one a line.
+ *
+ * @info: The parameter struct; a < redirection in info->fds is used.
+ * @fd: The descriptor to read, or -1 for the builtin's stdin.
+ * @n: Where the number of items is stored.
+ * @buf: Where the buffer they live in is stored, for the caller to free.
+ *
+ * Empty lines are skipped. The whole input is read in one buffer that
+ * doubles as it fills, and the items point into it.
+ *
+ * Return: The items, NULL-terminated, in a new array; NULL on failure.
+ */
+char **read_items(info_t *info, int fd, int *n, char **buf)
+{
+	fdmap_t *fds = &(info->fds);
+	size_t size = 0, len = 0, i, lines = 1;
+	char **items, *p;
+	ssize_t r = 1;
+	int k, in = STDIN_FILENO;
+
+	for (k = 0; k < fds->n; k++)
+		if (fds->fd[k] == STDIN_FILENO)
+			in = fds->to[k];
+	fd = fd == -1 ? in : fd;
+	for (*buf = NULL; r > 0 || (r == -1 && errno == EINTR);)
+	{
+		if (len + 1 >= size)
+		{
+			size = size ? size * 2 : READ_BIG_SIZE;
+			p = realloc(*buf, size);
+			if (!p)
+				return (NULL);
+			*buf = p;
+		}
+		r = read(fd, *buf + len, size - len - 1);
+		if (r > 0)
+			len += r;
+	}
+	for (i = 0; i < len; i++)
+		lines += (*buf)[i] == '\n';
+	items = malloc(sizeof(char *) * (lines + 1));
+	if (!items)
+		return (NULL);
+	for (*n = 0, (*buf)[len] = '\0', p = *buf, i = 0; i <= len; i++)
+		if ((*buf)[i] == '\n' || (*buf)[i] == '\0')
+		{
+			(*buf)[i] = '\0';
+			if (*p)
+				items[(*n)++] = p;
+			p = *buf + i + 1;
+		}
+	items[*n] = NULL;
+	return (items);
+}
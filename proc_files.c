@@ -32,34 +32,43 @@ char *get_history_file(info_t *info)
 }
 
 /**
- * write_history - Records system information to a file or
- * appends to an existing one.
+ * write_history - Appends this session's new lines to the history file.
  *
  * @info: Pointer to the parameter struct containing system data.
  *
+ * Only lines not yet saved are written, so the cost of a flush does not
+ * depend on the size of the history. The file is locked while it is
+ * touched so concurrent shells never interleave or clobber each other,
+ * and once it holds more than twice HIST_MAX lines it is cut back to
+ * the last HIST_MAX. A shell that saves without ever having loaded the
+ * history (a script run with HISTSAVE or HISTFLUSH) counts the file's
+ * lines on its first save instead.
+ *
  * Return: 1 on successful write, -1 on failure.
  */
 int write_history(info_t *info)
 {
 	ssize_t fd;
-	char *filename = get_history_file(info);
-	list_t *node = NULL;
+	char *filename;
+	int r;
 
+	if (info->history.saved >= info->histcount)
+		return (1);
+	filename = get_history_file(info);
 	if (!filename)
 		return (-1);
-
-	fd = open(filename, O_CREAT | O_TRUNC | O_RDWR, 0644);
+	fd = open(filename, O_CREAT | O_RDWR | O_APPEND, 0644);
 	free(filename);
 	if (fd == -1)
 		return (-1);
-	for (node = info->history; node; node = node->next)
-	{
-		_putsfd(node->str, fd);
-		_putfd('\n', fd);
-	}
-	_putfd(BUF_FLUSH, fd);
+	flock(fd, LOCK_EX);
+	if (!info->history.loaded && !info->history.file_lines)
+		info->history.file_lines = hist_count(fd);
+	r = hist_append(info, fd);
+	if (r != -1 && info->history.file_lines > HIST_MAX * 2)
+		hist_compact(info, fd);
 	close(fd);
-	return (1);
+	return (r == -1 ? -1 : 1);
 }
 
 /**
@@ -73,8 +82,7 @@ int write_history(info_t *info)
 int read_history(info_t *info)
 {
 	int i, last = 0, linecount = 0;
-	ssize_t fd, rdlen, fsize = 0;
-	struct stat st;
+	ssize_t fd, fsize = 0;
 	char *buf = NULL, *filename = get_history_file(info);
 
 	if (!filename)
@@ -84,18 +92,11 @@ int read_history(info_t *info)
 	free(filename);
 	if (fd == -1)
 		return (0);
-	if (!fstat(fd, &st))
-		fsize = st.st_size;
-	if (fsize < 2)
-		return (0);
-	buf = malloc(sizeof(char) * (fsize + 1));
+	flock(fd, LOCK_SH);
+	buf = hist_slurp(fd, &fsize);
+	close(fd);
 	if (!buf)
 		return (0);
-	rdlen = read(fd, buf, fsize);
-	buf[fsize] = 0;
-	if (rdlen <= 0)
-		return (free(buf), 0);
-	close(fd);
 	for (i = 0; i < fsize; i++)
 		if (buf[i] == '\n')
 		{
@@ -106,32 +107,25 @@ int read_history(info_t *info)
 	if (last != i)
 		build_history_list(info, buf + last, linecount++);
 	free(buf);
-	info->histcount = linecount;
-	while (info->histcount-- >= HIST_MAX)
-		delete_node_at_index(&(info->history), 0);
-	renumber_history(info);
+	info->history.file_lines = linecount;
+	info->history.saved = renumber_history(info);
 	return (info->histcount);
 }
 
 /**
- * build_history_list - Augments the history linked list with an entry.
+ * build_history_list - Augments the history ring with an entry.
  *
  * @info: Struct for managing potential arguments and history.
  * @buf: Buffer containing the entry to be added.
  * @linecount: Current history line count (histcount).
  *
+ * Once HIST_MAX lines are held, each new entry evicts the oldest.
+ *
  * Return: Always returns 0.
  */
 int build_history_list(info_t *info, char *buf, int linecount)
 {
-	list_t *node = NULL;
-
-	if (info->history)
-		node = info->history;
-	add_node_end(&node, buf, linecount);
-
-	if (!info->history)
-		info->history = node;
+	hist_push(info, buf, linecount);
 	return (0);
 }
 
@@ -140,7 +134,7 @@ int build_history_list(info_t *info, char *buf, int linecount)
  *
  * @info: Information structure holding relevant arguments for maintenance.
  *
- * This function renumbers the linked list of history entries to reflect any
+ * This function renumbers the ring of history entries to reflect any
  * changes or modifications made to the history. It ensures that history
  * entries are sequentially ordered,
  * making retrieval and navigation consistent.
@@ -149,13 +143,10 @@ int build_history_list(info_t *info, char *buf, int linecount)
  */
 int renumber_history(info_t *info)
 {
-	list_t *node = info->history;
-	int i = 0;
+	history_t *h = &(info->history);
+	int i;
 
-	while (node)
-	{
-		node->num = i++;
-		node = node->next;
-	}
+	for (i = 0; i < h->count; i++)
+		h->ent[(h->first + i) % HIST_MAX].num = i;
 	return (info->histcount = i);
 }
@@ -0,0 +1,192 @@
+/*
+ * File_name: redir.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * redir_add - Opens the target of one redirection and queues its move.
+ *
+ * @info: The parameter struct.
+ * @op: The redirection token.
+ * @word: Its target, or NULL if the command ended before one.
+ *
+ * < > >> and <> open a file, close-on-exec so only the copy moved into
+ * place survives an exec; >& and <& duplicate a descriptor by number.
+ * << and <<- take the body doc_read() stored, and <<< stores its word.
+ * Failures are reported the way dash reports them.
+ *
+ * Return: 0 on success, -1 on failure.
+ */
+static int redir_add(info_t *info, token_t *op, char *word)
+{
+	static const int flags[] = {O_RDONLY, O_WRONLY | O_CREAT | O_TRUNC,
+		O_WRONLY | O_CREAT | O_APPEND, O_RDWR | O_CREAT};
+	fdmap_t *fds = &(info->fds);
+	char *p = info->lex.line + op->off, *end = p + op->len;
+	long fd = op->kind == TOK_GREAT || op->kind == TOK_DGREAT
+		|| op->kind == TOK_GREATAND, to = -1;
+	int dup = op->kind == TOK_LESSAND || op->kind == TOK_GREATAND;
+	int err = EBADF;
+
+	if (*p < '0' || *p > '9')
+		p = end;
+	for (fd = p < end ? 0 : fd; p < end && fd <= INT_MAX / 10; p++)
+		fd = fd * 10 + (*p - '0');
+	if (word && fds->n < FDMAP_MAX && p == end)
+	{
+		if (dup)
+			to = !_atol(word, &to) && to >= 0 && to <= INT_MAX
+				&& fcntl(to, F_GETFD) != -1 ? to : -1;
+		else if (op->kind >= TOK_DLESS)
+			to = op->kind == TOK_TLESS ? doc_string(word) : op->fd,
+				op->fd = -1;
+		else
+			to = open(word, flags[op->kind - TOK_LESS] | O_CLOEXEC,
+					0666);
+		err = to == -1 && !dup ? errno : EBADF;
+	}
+	if (to == -1 || !word)
+	{
+		_eputs(info->fname), _eputs(": ");
+		print_d(info->line_count, STDERR_FILENO);
+		_eputs(!word ? ": Syntax error: newline unexpected\n"
+				: dup ? ": " : ": cannot open ");
+		if (word)
+			_eputs(word), _eputs(": "), _eputs(strerror(err)),
+				_eputs("\n");
+		return (-1);
+	}
+	fds->fd[fds->n] = fd, fds->to[fds->n] = to, fds->own[fds->n++] = !dup;
+	return (0);
+}
+
+/**
+ * redir_open - Opens every redirection of a command, in order.
+ *
+ * @info: The parameter struct holding the lexed line.
+ * @from: Index of the command's first token.
+ *
+ * The moves are appended to info->fds after any already there, such as
+ * a pipeline's. A target that is a lone $NAME is expanded first, unless
+ * it ends a here-document.
+ *
+ * Return: 0 on success; on failure the status is set to 2, whatever was
+ *         opened is closed again, and 2 is returned.
+ */
+int redir_open(info_t *info, int from)
+{
+	lex_t *lx = &(info->lex);
+	char *av[2], **argv = info->argv, *word;
+	int i;
+
+	for (i = from; i < lx->end && lx->tok[i].kind != TOK_PIPE; i++)
+	{
+		if (!IS_REDIR(lx->tok[i].kind))
+			continue;
+		word = NULL;
+		if (i + 1 < lx->end && lx->tok[i + 1].kind == TOK_WORD)
+			word = lx->line + lx->tok[i + 1].off;
+		if (word && word[0] == '$' && lx->tok[i].kind != TOK_DLESS
+				&& lx->tok[i].kind != TOK_DLESSDASH)
+		{
+			av[0] = word, av[1] = NULL, info->argv = av;
+			replace_vars(info);
+			word = av[0], info->argv = argv;
+		}
+		if (redir_add(info, &(lx->tok[i]), word))
+		{
+			redir_close(info);
+			return (info->status = 2);
+		}
+	}
+	return (0);
+}
+
+/**
+ * redir_close - Forgets a command's moves once it has started.
+ *
+ * @info: The parameter struct.
+ *
+ * Only the files redir_open() opened are closed; pipe ends belong to
+ * the pipeline.
+ */
+void redir_close(info_t *info)
+{
+	fdmap_t *fds = &(info->fds);
+	int i;
+
+	for (i = 0; i < fds->n; i++)
+		if (fds->own[i])
+			close(fds->to[i]);
+	fds->n = 0;
+}
+
+/**
+ * redir_writers - Applies a builtin's moves to the shell's writers.
+ *
+ * @info: The parameter struct.
+ * @on: 1 to point stdout and stderr where info->fds says, 0 to put
+ *      them back.
+ *
+ * The builtin runs in the shell, so nothing is dup2()ed: its output
+ * buffers are retargeted instead. Moves are followed in order, so
+ * 2>&1 >file still leaves stderr on the old stdout.
+ */
+void redir_writers(info_t *info, int on)
+{
+	fdmap_t *fds = &(info->fds);
+	int to[3], i, t;
+
+	to[0] = STDIN_FILENO, to[1] = STDOUT_FILENO, to[2] = STDERR_FILENO;
+	for (i = 0; on && i < fds->n; i++)
+	{
+		t = fds->to[i];
+		if (fds->fd[i] <= STDERR_FILENO)
+			to[fds->fd[i]] = !fds->own[i] && t <= STDERR_FILENO
+				? to[t] : t;
+	}
+	w_redirect(STDOUT_FILENO, to[1]);
+	w_redirect(STDERR_FILENO, to[2]);
+}
+
+/**
+ * redir_run - Runs a command that has redirections.
+ *
+ * @info: The parameter struct holding the lexed line.
+ *
+ * An external command gets the moves through spawn_cmd(); a builtin
+ * runs in the shell with its writers retargeted, so echo x >> log
+ * starts no process. With no command at all the files are just opened
+ * (and created) and closed again.
+ *
+ * Return: What the builtin returned, 0 for anything else, or 1 if a
+ *         redirection failed.
+ */
+int redir_run(info_t *info)
+{
+	builtin_table *builtin = builtin_lookup(info->argv[0]);
+	int ret = 0;
+
+	if (builtin)
+		info->line_count++;
+	else if (info->linecount_flag)
+		info->line_count++, info->linecount_flag = 0;
+	info->fds.n = 0;
+	if (redir_open(info, info->lex.start))
+		return (1);
+	if (builtin)
+	{
+		redir_writers(info, 1);
+		ret = builtin->func(info);
+		redir_writers(info, 0);
+	}
+	else if (*info->argv[0])
+		find_cmd(info);
+	else
+		info->status = 0;
+	redir_close(info);
+	return (ret);
+}
@@ -1,6 +1,10 @@
 #ifndef _SHELL_H_
 #define _SHELL_H_
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* pipe2(), F_SETPIPE_SZ */
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -11,18 +15,77 @@
 #include <limits.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <spawn.h>
+#include <sys/file.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <sys/ioctl.h>
 
 /* buffer readers */
 #define READ_BUF_SIZE 1024
-#define WRITE_BUF_SIZE 1024
+#define READ_BIG_SIZE 65536
+#define MAP_TRIM_SIZE (1 << 20)
+#ifndef WRITE_BUF_SIZE
+#define WRITE_BUF_SIZE 8192
+#endif
+#define WRITERS 3
 #define BUF_FLUSH -1
 
 /* chain commands */
 #define CMD_AND		2
 #define CMD_CHAIN	3
+#define CMD_BG		4
 #define CMD_NORM	0
 #define CMD_OR		1
 
+/* lexer byte classes */
+#define CH_BLANK	1
+#define CH_OP		2
+#define CH_QUOTE	4
+#define CH_HASH		8
+#define CH_END		16
+
+/* token kinds; chain operators use the CMD_ types */
+#define TOK_WORD	16
+#define TOK_PIPE	17
+
+/* redirections; the span is the fd number before the operator, if any */
+#define TOK_LESS	18
+#define TOK_GREAT	19
+#define TOK_DGREAT	20
+#define TOK_LESSGREAT	21
+#define TOK_LESSAND	22
+#define TOK_GREATAND	23
+#define TOK_DLESS	24
+#define TOK_DLESSDASH	25
+#define TOK_TLESS	26
+#define IS_REDIR(kind)	((kind) >= TOK_LESS)
+
+/* fd moves made for a command */
+#define FDMAP_MAX	16
+
+/* bytes of ARG_MAX the batch builtin leaves unused, as xargs does */
+#define BATCH_SLACK	2048
+
+/* dag task states */
+#define TASK_WAIT	0
+#define TASK_RUN	1
+#define TASK_OK		2
+#define TASK_FAIL	3
+#define TASK_SKIP	4
+
+/* characters that make a dag command need sh -c */
+#define DAG_META	"|&;<>()$`\\\"'*?[]#~=%{}\n"
+
+/* printf flags */
+#define PF_LEFT		1
+#define PF_ZERO		2
+
 /* convert_num */
 #define CONVERT_UNSIGNED	2
 #define CONVERT_LOWERCASE	1
@@ -31,8 +94,47 @@
 #define USE_GETLINE 0
 #define USE_STRTOK 0
 
+/* 1 to launch commands with posix_spawn(), 0 for fork() + execve() */
+#ifndef USE_SPAWN
+#define USE_SPAWN 1
+#endif
+
 #define HIST_FILE	".simple_shell_history"
 #define HIST_MAX	4096
+#define HIST_IOV	1024
+
+/* per-command arena */
+#define ARENA_SIZE	4096
+#define ARENA_ALIGN	16
+
+/* command hash */
+#define CMD_HASH_SIZE	64
+
+#define TS_EQUAL(a, b) ((a).tv_sec == (b).tv_sec && (a).tv_nsec == (b).tv_nsec)
+#define TS_AFTER(a, b) ((a).tv_sec > (b).tv_sec || \
+		((a).tv_sec == (b).tv_sec && (a).tv_nsec > (b).tv_nsec))
+
+/* word-at-a-time string scanning */
+typedef unsigned long __attribute__((__may_alias__)) word_t;
+#define WORD_SIZE	sizeof(word_t)
+#define WORD_ONES	((word_t)-1 / 0xff)
+#define WORD_HIGHS	(WORD_ONES << 7)
+#define WORD_HAS_ZERO(w) (((w) - WORD_ONES) & ~(w) & WORD_HIGHS)
+#define WORD_ALIGNED(p) (!((size_t)(p) % WORD_SIZE))
+
+/*
+ * Scanning reads whole words or vectors that may run past the terminator,
+ * though never past the page holding it. AddressSanitizer would report
+ * those bytes, so functions doing it are left uninstrumented.
+ */
+#define NO_ASAN __attribute__((no_sanitize_address))
+
+/* SSE2/AVX2 string scanning on x86-64, picked at startup by CPU support */
+#if defined(__x86_64__) && defined(__GNUC__)
+#define STR_SIMD	1
+#define STR_PAGE	4096
+#define STR_AVX2_FN	__attribute__((target("avx2")))
+#endif
 
 extern char **environ;
 
@@ -54,6 +156,396 @@ typedef struct liststr
 	struct liststr *next;
 } list_t;
 
+/**
+ * struct cmdhash - A remembered command location.
+ *
+ * @name: The command name as typed.
+ * @path: The resolved full path, or NULL if the command was not found.
+ * @stamp: Modification time of the directory (or, for misses, the newest
+ *         PATH directory) when the entry was made.
+ * @hits: How many lookups this entry has answered.
+ * @next: Pointer to the next entry in the same bucket.
+ */
+typedef struct cmdhash
+{
+	char *name;
+	char *path;
+	struct timespec stamp;
+	int hits;
+	struct cmdhash *next;
+} cmdhash_t;
+
+/**
+ * struct writer - An output buffer bound to one file descriptor.
+ *
+ * @fd: The file descriptor the buffer is for, -1 if unbound.
+ * @to: The descriptor it actually drains to; @fd unless redirected.
+ * @len: Bytes waiting in @buf.
+ * @buf: The pending output.
+ */
+typedef struct writer
+{
+	int fd;
+	int to;
+	size_t len;
+	char buf[WRITE_BUF_SIZE];
+} writer_t;
+
+/**
+ * struct inbuf - The reusable input buffer lines are handed out from.
+ *
+ * @buf: The buffer; one byte is always kept spare for a terminator.
+ * @size: Bytes allocated for @buf.
+ * @pos: Start of the input not yet handed out as a line.
+ * @end: End of the input read so far.
+ * @scan: Bytes after @pos already known to hold no newline.
+ * @chunk: Bytes asked for per read(), 0 until the fd has been looked at.
+ * @eof: Set once read() has reported end of input.
+ * @mapped: Length of the mapping when @buf maps a script, 0 otherwise.
+ * @trimmed: Bytes at the start of the mapping already given back.
+ */
+typedef struct inbuf
+{
+	char *buf;
+	size_t size;
+	size_t pos;
+	size_t end;
+	size_t scan;
+	size_t chunk;
+	int eof;
+	size_t mapped;
+	size_t trimmed;
+} inbuf_t;
+
+/**
+ * struct stage - One command of a pipeline.
+ *
+ * @tok: Index of the stage's first token.
+ * @in: Descriptor for its stdin, or -1 for the shell's.
+ * @out: Descriptor for its stdout, or -1 for the shell's.
+ * @pid: Its process; 0 once reaped or if none was started, -1 while it
+ *       waits to run inside the shell.
+ * @status: Its exit status.
+ * @argv: Its expanded arguments.
+ * @argc: How many there are.
+ */
+typedef struct stage
+{
+	int tok;
+	int in;
+	int out;
+	pid_t pid;
+	int status;
+	char **argv;
+	int argc;
+} stage_t;
+
+/**
+ * struct job - A command left running in the background with '&'.
+ *
+ * @id: Its number, as in %1.
+ * @pid: Its processes, one per pipeline stage; negated once reaped, and
+ *       0 for a stage that never started.
+ * @n: The number of stages.
+ * @live: How many of them are still running.
+ * @status: The exit status of its last stage, once known.
+ * @cmd: The command, as jobs shows it.
+ * @next: The job started after it.
+ */
+typedef struct job
+{
+	int id;
+	pid_t *pid;
+	int n;
+	int live;
+	int status;
+	char *cmd;
+	struct job *next;
+} job_t;
+
+/**
+ * struct pool - Commands run a bounded number at a time.
+ *
+ * @pid: The child in each slot, 0 if the slot is free.
+ * @tag: What the caller started in each slot.
+ * @max: The number of slots.
+ * @running: How many slots are taken.
+ */
+typedef struct pool
+{
+	pid_t *pid;
+	int *tag;
+	int max;
+	int running;
+} pool_t;
+
+/**
+ * struct par - The state of one run of the parallel builtin.
+ *
+ * @pool: The commands running.
+ * @tmpl: The command to run for each item, NULL-terminated.
+ * @item: The items.
+ * @n: How many there are.
+ * @keep: 1 if output is kept in item order.
+ * @out: For --keep-order, the memfd each item's output went to.
+ * @done: 1 for each item that has finished.
+ * @next: The first item whose output is not yet written.
+ * @failed: How many items failed.
+ * @in: /dev/null for the commands' stdin when the items came from it,
+ *      or -1.
+ */
+typedef struct par
+{
+	pool_t pool;
+	char **tmpl;
+	char **item;
+	int n;
+	int keep;
+	int *out;
+	char *done;
+	int next;
+	int failed;
+	int in;
+} par_t;
+
+/**
+ * struct batch - The state of one run of the batch builtin.
+ *
+ * @pool: The commands running.
+ * @tmpl: The command each batch of items is added to.
+ * @nt: How many words it has.
+ * @item: The items.
+ * @n: How many there are.
+ * @next: The first item not yet given to a command.
+ * @room: The bytes of arguments left for items in each command line.
+ * @max: The most items in one command line, or 0 for no limit.
+ * @failed: How many commands failed.
+ * @in: /dev/null for the commands' stdin when the items came from it,
+ *      or -1.
+ */
+typedef struct batch
+{
+	pool_t pool;
+	char **tmpl;
+	int nt;
+	char **item;
+	int n;
+	int next;
+	long room;
+	int max;
+	int failed;
+	int in;
+} batch_t;
+
+/**
+ * struct task - One task of a dag run.
+ *
+ * @name: The task's name.
+ * @cmd: Its command lines, joined by newlines; NULL if it only groups
+ *       the tasks it depends on.
+ * @deps: The names it depends on, as written, until dag_link() runs.
+ * @dep: The indexes of the tasks it depends on.
+ * @ndep: How many there are.
+ * @waiting: How many of them have not finished yet.
+ * @state: One of the TASK_* states.
+ * @start: When it started, in milliseconds.
+ * @took: How long it ran, in milliseconds.
+ * @path: The longest chain of run times ending with it.
+ * @via: The dependency that chain comes through, or -1.
+ */
+typedef struct task
+{
+	char *name;
+	char *cmd;
+	char *deps;
+	int *dep;
+	int ndep;
+	int waiting;
+	int state;
+	long start;
+	long took;
+	long path;
+	int via;
+} task_t;
+
+/**
+ * struct dag - The state of one run of the dag builtin.
+ *
+ * @pool: The commands running.
+ * @task: The tasks, in the order of the task file.
+ * @n: How many there are.
+ * @keep: 1 to go on with the tasks a failure does not block.
+ * @failed: How many tasks failed.
+ */
+typedef struct dag
+{
+	pool_t pool;
+	task_t *task;
+	int n;
+	int keep;
+	int failed;
+} dag_t;
+
+/**
+ * struct token - A span of the input line.
+ *
+ * @off: Offset of the token in the line.
+ * @len: Length of the token.
+ * @kind: TOK_WORD, TOK_PIPE, a TOK_ redirection, or CMD_CHAIN, CMD_AND
+ *        or CMD_OR for a chain operator.
+ * @fd: For << and <<-, the file holding the here-document's body until
+ *      the command takes it; -1 otherwise.
+ */
+typedef struct token
+{
+	size_t off;
+	size_t len;
+	int kind;
+	int fd;
+} token_t;
+
+/**
+ * struct lexer - Tokens of the line being run.
+ *
+ * @tok: The token spans, in line order.
+ * @count: Number of tokens.
+ * @cap: Number of tokens allocated.
+ * @pos: Index of the first token not yet run.
+ * @start: First word of the current command.
+ * @end: One past the last word of the current command.
+ * @line: The line the spans point into.
+ * @eol: Offset of the line's terminating NUL.
+ * @pipes: Number of '|' between @start and @end.
+ * @redirs: Number of redirections between @start and @end.
+ * @bg: 1 if the current command ends with '&'.
+ * @docs: Number of here-documents in the line.
+ * @copy: A copy of the line, made when its here-documents are read.
+ */
+typedef struct lexer
+{
+	token_t *tok;
+	int count;
+	int cap;
+	int pos;
+	int start;
+	int end;
+	char *line;
+	size_t eol;
+	int pipes;
+	int redirs;
+	int bg;
+	int docs;
+	char *copy;
+} lex_t;
+
+/**
+ * struct fdmap - File descriptors to move before a command runs.
+ *
+ * @fd: The descriptor the command sees.
+ * @to: The descriptor dup2()ed onto @fd.
+ * @own: 1 if @to was opened for this command, and is closed once it has
+ *       started.
+ * @n: Number of moves, made in order.
+ */
+typedef struct fdmap
+{
+	int fd[FDMAP_MAX];
+	int to[FDMAP_MAX];
+	int own[FDMAP_MAX];
+	int n;
+} fdmap_t;
+
+/**
+ * struct arena - Bump-pointer allocator released all at once.
+ *
+ * @base: The newest block; its first ARENA_ALIGN bytes link to the
+ *        block before it.
+ * @size: Size of the newest block.
+ * @used: Bytes of the newest block handed out, header included.
+ */
+typedef struct arena
+{
+	char *base;
+	size_t size;
+	size_t used;
+} arena_t;
+
+/**
+ * struct histent - A line in the history ring.
+ *
+ * @off: Offset of the line's text in the history arena.
+ * @num: The history number of the line.
+ */
+typedef struct histent
+{
+	size_t off;
+	int num;
+} histent_t;
+
+/**
+ * struct history - Fixed-capacity ring of history lines.
+ *
+ * @ent: Ring of HIST_MAX entries.
+ * @first: Ring index of the oldest line.
+ * @count: Number of lines held.
+ * @arena: The lines' text, NUL-terminated and stored back to back.
+ * @size: Bytes allocated for the arena.
+ * @used: Bytes of the arena in use, including evicted lines not yet
+ *        compacted away.
+ * @saved: History number of the first line not yet in the history file.
+ * @file_lines: Estimated number of lines in the history file.
+ * @loaded: Set once the history file has been read.
+ */
+typedef struct history
+{
+	histent_t *ent;
+	int first;
+	int count;
+	char *arena;
+	size_t size;
+	size_t used;
+	int saved;
+	int file_lines;
+	int loaded;
+} history_t;
+
+/**
+ * struct envidx - Open-addressing index over the environment list.
+ *
+ * @slots: Table of pointers to the env nodes, keyed on variable name.
+ * @size: Number of slots; always zero or a power of two.
+ * @used: Slots that are not empty (live nodes and tombstones).
+ * @live: Slots holding a node.
+ */
+typedef struct envidx
+{
+	list_t **slots;
+	size_t size;
+	size_t used;
+	size_t live;
+} envidx_t;
+
+/**
+ * struct ev - The descriptors the shell waits on between commands.
+ *
+ * @ep: The epoll set, or -1 if signals are left to their handlers.
+ * @sig: The signalfd for SIGCHLD, SIGINT and SIGWINCH, or -1.
+ * @timer: The timerfd for TMOUT, or -1.
+ * @in: The input fd once added to @ep; -1 before, -2 if it cannot be
+ *      polled (a regular file).
+ * @chld: Set when SIGCHLD has come in since jobs_reap() last looked.
+ * @mask: The signal mask the shell started with, for its children.
+ */
+typedef struct ev
+{
+	int ep;
+	int sig;
+	int timer;
+	int in;
+	int chld;
+	sigset_t mask;
+} ev_t;
+
 /**
  * struct passinfo - Stores parameters to be passed into a function,
  * enabling a consistent function pointer struct prototype.
@@ -68,8 +560,8 @@ typedef struct liststr
  * @fname: The filename of the program.
  * @env: A linked list serving as a local copy of 'environ'.
  * @environ: A custom-modified copy of 'environ'
- * derived from the 'env' linked list.
- * @history: The history node.
+ * derived from the 'env' linked list, sharing its strings.
+ * @history: The history ring.
  * @alias: The alias node.
  * @env_changed: Set to 'on' if 'environ' was altered.
  * @status: The return status of the last executed command.
@@ -77,6 +569,26 @@ typedef struct liststr
  * @cmd_buf_type: The command type (||, &&, ;).
  * @readfd: The file descriptor from which to read line input.
  * @histcount: The count of history line numbers.
+ * @cmd_hash: Buckets of the remembered command locations.
+ * @env_idx: Name index over the 'env' list.
+ * @env_tail: The last node of the 'env' list, for O(1) appends.
+ * @env_count: Number of entries in 'environ'.
+ * @env_cap: Number of slots allocated for 'environ'.
+ * @env_builds: How many times 'environ' was built from scratch.
+ * @arena: Per-command memory for argv and expansions; reset by
+ *         clear_info().
+ * @lex: Token spans of the current input line.
+ * @in: The input buffer the lines are read into.
+ * @is_tty: Whether the shell is interactive; decided once by main().
+ * @fds: Descriptors to move in the child of the command being started.
+ * @async_pid: If set, fork_cmd() stores the child's pid here and returns
+ *             without waiting for it.
+ * @jobs: The background jobs, oldest first.
+ * @last_bg: The pid of the last background command, as $! gives it, or
+ *           0 before the first, when $! is empty.
+ * @pipestatus: The statuses of the last pipeline's stages, as
+ *              $PIPESTATUS gives them; kept out of the environment.
+ * @ev: What the shell waits on for input, signals and timeouts.
  */
 typedef struct passinfo
 {
@@ -89,7 +601,7 @@ typedef struct passinfo
 	int linecount_flag;
 	char *fname;
 	list_t *env;
-	list_t *history;
+	history_t history;
 	list_t *alias;
 	char **environ;
 	int env_changed;
@@ -99,17 +611,42 @@ typedef struct passinfo
 	int cmd_buf_type; /* CMD_type ||, &&, ; */
 	int readfd;
 	int histcount;
+	cmdhash_t **cmd_hash;
+	envidx_t env_idx;
+	list_t *env_tail;
+	int env_count;
+	int env_cap;
+	int env_builds;
+	arena_t arena;
+	lex_t lex;
+	inbuf_t in;
+	int is_tty;
+	fdmap_t fds;
+	pid_t *async_pid;
+	job_t *jobs;
+	pid_t last_bg;
+	char *pipestatus;
+	ev_t ev;
 } info_t;
 
 #define INFO_INIT \
-{NULL, NULL, NULL, 0, 0, 0, 0, NULL, NULL, NULL, NULL, NULL, 0, 0, NULL, \
-		0, 0, 0}
+{NULL, NULL, NULL, 0, 0, 0, 0, NULL, NULL, \
+		{NULL, 0, 0, NULL, 0, 0, 0, 0, 0}, NULL, NULL, 0, 0, NULL, \
+		0, 0, 0, NULL, {NULL, 0, 0, 0}, NULL, 0, 0, 0, \
+		{NULL, 0, 0}, \
+		{NULL, 0, 0, 0, 0, 0, NULL, 0, 0, 0, 0, 0, NULL}, \
+		{NULL, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {{0}, {0}, {0}, 0}, NULL, \
+		NULL, 0, NULL, {-1, -1, -1, -1, 0, {{0}}}}
 
 /**
  * struct builtin - Couples a command type and its corresponding function.
  *
  * @type: Builtin command flag.
  * @func: Associated function pointer.
+ * @inproc: 1 if the builtin leaves the shell's state alone and returns
+ *          as soon as it has printed, so it can run inside the shell
+ *          even as a pipeline stage. One that waits, like sleep, would
+ *          hold up the shell and every later stage, so it gets a child.
  *
  * This structure pairs a builtin command flag with its corresponding
  * function pointer, facilitating the execution of built-in commands
@@ -119,19 +656,92 @@ typedef struct builtin
 {
 	char *type;
 	int (*func)(info_t *);
+	int inproc;
 } builtin_table;
 
+/*
+ * Builtin registry: one X(name, c0, c1, func, inproc) line per builtin,
+ * where c0 and c1 are the first two characters of name ('\0' if it has
+ * only one) and inproc is as in struct builtin.
+ * find_builtin() switches on BUILTIN_KEY(length, c0, c1), so each
+ * command costs one switch and at most one string compare whether or
+ * not it is a builtin. Two builtins sharing a key fail to compile with
+ * a duplicate case value. The compiler cannot take c0 and c1 from the
+ * name itself, so tests/builtins.sh checks that they match it.
+ */
+#define BUILTINS(X) \
+	X("exit", 'e', 'x', _myexit, 0) \
+	X("env", 'e', 'n', _myenv, 1) \
+	X("help", 'h', 'e', _myhelp, 1) \
+	X("history", 'h', 'i', _myhistory, 1) \
+	X("setenv", 's', 'e', _mysetenv, 0) \
+	X("unsetenv", 'u', 'n', _myunsetenv, 0) \
+	X("cd", 'c', 'd', _mycd, 0) \
+	X("alias", 'a', 'l', _myalias, 0) \
+	X("hash", 'h', 'a', _myhash, 0) \
+	X("type", 't', 'y', _mytype, 1) \
+	X("command", 'c', 'o', _mycommand, 0) \
+	X("echo", 'e', 'c', _myecho, 1) \
+	X("printf", 'p', 'r', _myprintf, 1) \
+	X("true", 't', 'r', _mytrue, 1) \
+	X("false", 'f', 'a', _myfalse, 1) \
+	X("pwd", 'p', 'w', _mypwd, 1) \
+	X("sleep", 's', 'l', _mysleep, 0) \
+	X("test", 't', 'e', _mytest, 1) \
+	X("[", '[', '\0', _mybracket, 1) \
+	X("jobs", 'j', 'o', _myjobs, 1) \
+	X("wait", 'w', 'a', _mywait, 0) \
+	X("parallel", 'p', 'a', _myparallel, 0) \
+	X("batch", 'b', 'a', _mybatch, 0) \
+	X("dag", 'd', 'a', _mydag, 0)
+
+#define BUILTIN_KEY(len, c0, c1) ((((len) & 0x7f) << 16) \
+		| ((unsigned char)(c0) << 8) | (unsigned char)(c1))
 
 /* loop.c */
 int hsh(info_t *, char **);
 int find_builtin(info_t *);
+builtin_table *builtin_lookup(char *);
 void find_cmd(info_t *);
 void fork_cmd(info_t *);
 
+/* spawn.c */
+int spawn_fork(info_t *, pid_t *);
+int spawn_cmd(info_t *, pid_t *);
+int spawn_builtin(info_t *, builtin_table *, stage_t *, int);
+
+/* pipeline.c */
+int run_pipeline(info_t *);
+
+/* heredoc.c */
+void doc_read(info_t *);
+int doc_string(char *);
+void doc_close(info_t *);
+
+/* redir.c */
+int redir_open(info_t *, int);
+void redir_close(info_t *);
+void redir_writers(info_t *, int);
+int redir_run(info_t *);
+
+/* stage.c */
+int stage_start(info_t *, stage_t *, int);
+void stage_run(info_t *, stage_t *);
+void stage_wait(info_t *, stage_t *, int);
+void stage_shed(info_t *, stage_t *, int);
+
 /* locatorsc */
 int is_cmd(info_t *, char *);
 char *dup_chars(char *, int, int);
 char *find_path(info_t *, char *, char *);
+int path_mtime(char *, struct timespec *);
+char *locate_cmd(info_t *, char *);
+
+/* cmd_hash.c */
+int hash_stamp(info_t *, char *, struct timespec *);
+cmdhash_t *hash_find(info_t *, char *);
+cmdhash_t *hash_add(info_t *, char *, char *);
+int hash_drop(info_t *, char *);
 
 /* loops.c */
 int loophsh(char **);
@@ -142,12 +752,37 @@ int _eputchar(char);
 int _putfd(char c, int fd);
 int _putsfd(char *str, int fd);
 
+/* writer.c */
+ssize_t w_write(int, const char *, size_t);
+int w_flush(int);
+void w_redirect(int, int);
+
 /* champ.c */
 int _strlen(char *);
 int _strcmp(char *, char *);
 char *starts_with(const char *, const char *);
 char *_strcat(char *, char *);
 
+/* str_word.c */
+size_t str_word_len(const char *);
+char *str_word_chr(const char *, char);
+size_t str_word_same(const char *, const char *);
+extern size_t (*str_len)(const char *);
+extern char *(*str_chr)(const char *, char);
+extern size_t (*str_same)(const char *, const char *);
+
+#ifdef STR_SIMD
+/* str_sse2.c */
+size_t str_sse2_len(const char *);
+char *str_sse2_chr(const char *, char);
+size_t str_sse2_same(const char *, const char *);
+
+/* str_avx2.c */
+size_t str_avx2_len(const char *);
+char *str_avx2_chr(const char *, char);
+size_t str_avx2_same(const char *, const char *);
+#endif
+
 /* champ1.c */
 char *_strcpy(char *, char *);
 char *_strdup(const char *);
@@ -158,10 +793,28 @@ int _putchar(char);
 char *_strncpy(char *, char *, int);
 char *_strncat(char *, char *, int);
 char *_strchr(char *, char);
+int _strncmp(char *, char *, size_t);
+char *_memchr(char *, char, size_t);
 
 /* _tokens.c */
-char **strtow(char *, char *);
 char **strtow2(char *, char);
+int split_words(char *, char **);
+int lex_drop(info_t *, char *);
+
+/* in_map.c */
+int in_map(info_t *);
+void in_trim(info_t *, size_t);
+void in_free(info_t *);
+
+/* lexer.c */
+int lex_line(info_t *, char *);
+int lex_next(info_t *);
+
+/* arena.c */
+void *arena_alloc(arena_t *, size_t);
+char *arena_strdup(arena_t *, const char *);
+void arena_reset(arena_t *);
+void arena_free(arena_t *);
 
 /* strt_.c */
 char *_memset(char *, char, unsigned int);
@@ -176,22 +829,82 @@ int interactive(info_t *);
 int is_delim(char, char *);
 int _isalpha(int);
 int _atoi(char *);
+int _atol(char *, long *);
 
 /* error_1.c */
 int _erratoi(char *);
 void print_error(info_t *, char *);
 int print_d(int, int);
 char *convert_number(long int, int, int);
-void remove_comments(char *);
 
 /* builtin1.c */
 int _myexit(info_t *);
 int _mycd(info_t *);
+int _mypwd(info_t *);
 int _myhelp(info_t *);
 
 /* builtin2.c */
 int _myhistory(info_t *);
 int _myalias(info_t *);
+int print_alias(list_t *);
+
+/* builtins3.c */
+int _myhash(info_t *);
+int _mytype(info_t *);
+int _mycommand(info_t *);
+
+/* builtins4.c */
+char *read_escape(char *, char *);
+char *put_escaped(char *, char);
+int _myecho(info_t *);
+int _mytrue(info_t *);
+int _myfalse(info_t *);
+
+/* builtins5.c */
+int _myprintf(info_t *);
+int _mysleep(info_t *);
+
+/* builtins6.c */
+int _mytest(info_t *);
+int _mybracket(info_t *);
+
+/* builtins7.c */
+void jobs_report(info_t *, int);
+void job_drop(info_t *, job_t *);
+int _myjobs(info_t *);
+int _mywait(info_t *);
+
+/* builtins8.c */
+int _myparallel(info_t *);
+
+/* builtins9.c */
+int _mybatch(info_t *);
+
+/* builtins10.c */
+int _mydag(info_t *);
+
+/* dag.c */
+long dag_now(void);
+int dag_parse(info_t *, dag_t *, char **, int);
+void dag_summary(dag_t *, long);
+
+/* pool.c */
+int pool_init(info_t *, pool_t *, long, int);
+int pool_start(info_t *, pool_t *, char **, int);
+int pool_wait(info_t *, pool_t *, int *);
+char **item_argv(info_t *, char **, char *);
+char **read_items(info_t *, int, int *, char **);
+
+/* events.c */
+int ev_init(info_t *);
+void ev_signals(info_t *, int);
+int ev_wait(info_t *);
+void ev_child(info_t *);
+
+/* jobs.c */
+int job_add(info_t *, stage_t *, int);
+job_t *job_note(info_t *, pid_t, int);
+job_t *jobs_reap(info_t *, int);
 
 /*get_lines.c */
 ssize_t get_input(info_t *);
@@ -201,6 +914,7 @@ void sigintHandler(int);
 /* input_info.c */
 void clear_info(info_t *);
 void set_info(info_t *, char **);
+int set_argv(info_t *, int);
 void free_info(info_t *, int);
 
 /* environment.c */
@@ -210,10 +924,15 @@ int _mysetenv(info_t *);
 int _myunsetenv(info_t *);
 int populate_env_list(info_t *);
 
+/* env_store.c */
+list_t *env_lookup(info_t *, const char *);
+int env_index(info_t *, list_t *, int);
+
 /* get_environ.c */
 char **get_environ(info_t *);
 int _unsetenv(info_t *, char *);
 int _setenv(info_t *, char *, char *);
+list_t *env_append(info_t *, char *);
 
 /* proc_file.c */
 char *get_history_file(info_t *info);
@@ -222,6 +941,18 @@ int read_history(info_t *info);
 int build_history_list(info_t *info, char *buf, int linecount);
 int renumber_history(info_t *info);
 
+/* hist_file.c */
+char *hist_slurp(int, ssize_t *);
+int hist_count(int);
+int hist_append(info_t *, int);
+int hist_compact(info_t *, int);
+
+/* history.c */
+int hist_push(info_t *, char *, int);
+char *hist_at(info_t *, int, int *);
+void hist_clear(info_t *);
+int hist_load(info_t *);
+
 /* link_list1.c */
 list_t *add_node(list_t **, const char *, int);
 list_t *add_node_end(list_t **, const char *, int);
@@ -237,8 +968,6 @@ list_t *node_starts_with(list_t *, char *, char);
 ssize_t get_node_index(list_t *, list_t *);
 
 /* msgs.c */
-int is_chain(info_t *, char *, size_t *);
-void check_chain(info_t *, char *, size_t *, size_t, size_t);
 int replace_alias(info_t *);
 int replace_vars(info_t *);
 int replace_string(char **, char *);
@@ -0,0 +1,159 @@
+/*
+ * File_name: spawn.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * fds_apply - Makes the descriptor moves of a command in its child.
+ *
+ * @fds: The moves; the descriptors moved from are close-on-exec, so
+ *       they vanish once the command is exec'd.
+ */
+static void fds_apply(fdmap_t *fds)
+{
+	int i;
+
+	for (i = 0; i < fds->n; i++)
+		if (fds->to[i] == fds->fd[i]) /* 3>file may open as 3 */
+			fcntl(fds->fd[i], F_SETFD, 0);
+		else
+			dup2(fds->to[i], fds->fd[i]);
+}
+
+/**
+ * spawn_fork - Launches a command with fork() and execve().
+ *
+ * @info: Pointer to the parameter and return info struct.
+ * @pid: Where the child's process id is stored.
+ *
+ * The child copies the whole shell before replacing itself, so this is
+ * the engine to use when something has to run in the child first. A
+ * failed execve() is reported through the child's exit status.
+ *
+ * Return: 0 on success, or the errno of the failed fork().
+ */
+int spawn_fork(info_t *info, pid_t *pid)
+{
+	*pid = fork();
+	if (*pid == -1)
+		return (errno);
+	if (*pid == 0)
+	{
+		ev_child(info);
+		fds_apply(&(info->fds));
+		if (execve(info->path, info->argv, get_environ(info)) == -1)
+		{
+			free_info(info, 1);
+			if (errno == EACCES)
+				exit(126);
+			exit(1);
+		}
+	}
+	return (0);
+}
+
+#if USE_SPAWN
+/**
+ * spawn_posix - Launches a command with posix_spawn().
+ *
+ * @info: Pointer to the parameter and return info struct.
+ * @pid: Where the child's process id is stored.
+ *
+ * posix_spawn() starts the child without copying the shell's page
+ * tables, which keeps launch time flat as history and environment grow.
+ * A failed exec is reported back as its errno, with no child left over.
+ * The moves in info->fds become dup2 file actions, and the child gets
+ * the signal mask the shell started with.
+ *
+ * Return: 0 on success, or the error posix_spawn() reported.
+ */
+static int spawn_posix(info_t *info, pid_t *pid)
+{
+	posix_spawn_file_actions_t fa, *fap = NULL;
+	posix_spawnattr_t at, *atp = NULL;
+	int i, err;
+
+	if (info->fds.n)
+	{
+		fap = &fa;
+		posix_spawn_file_actions_init(fap);
+		for (i = 0; i < info->fds.n; i++)
+			posix_spawn_file_actions_adddup2(fap, info->fds.to[i],
+					info->fds.fd[i]);
+	}
+	if (info->ev.sig != -1)
+	{
+		atp = &at;
+		posix_spawnattr_init(atp);
+		posix_spawnattr_setsigmask(atp, &(info->ev.mask));
+		posix_spawnattr_setflags(atp, POSIX_SPAWN_SETSIGMASK);
+	}
+	err = posix_spawn(pid, info->path, fap, atp,
+			info->argv, get_environ(info));
+	if (fap)
+		posix_spawn_file_actions_destroy(fap);
+	if (atp)
+		posix_spawnattr_destroy(atp);
+	return (err);
+}
+#endif
+
+/**
+ * spawn_cmd - Starts the command in @info as a child process.
+ *
+ * @info: Pointer to the parameter and return info struct.
+ * @pid: Where the child's process id is stored.
+ *
+ * The engine is chosen at build time with USE_SPAWN, so both can be
+ * benchmarked against each other (cc -DUSE_SPAWN=0 ... for fork()).
+ * Buffered output is flushed first, so the child never duplicates it.
+ *
+ * Return: 0 if a child was started, otherwise an errno value.
+ */
+int spawn_cmd(info_t *info, pid_t *pid)
+{
+	w_flush(-1);
+#if USE_SPAWN
+	return (spawn_posix(info, pid));
+#else
+	return (spawn_fork(info, pid));
+#endif
+}
+
+/**
+ * spawn_builtin - Runs a builtin in a forked copy of the shell.
+ *
+ * @info: Pointer to the parameter and return info struct.
+ * @builtin: The builtin to run.
+ * @s: The pipeline's stages, as for stage_start().
+ * @i: Index of the stage to run it as; its pid is stored there.
+ *
+ * Used for a pipeline stage, so the builtin sees the stage's
+ * descriptors and cannot change the shell itself. The shell's own
+ * descriptors are closed in the child by stage_shed(), as an exec
+ * would, or a builtin reading its stdin would hold open the very pipe
+ * it waits on.
+ *
+ * Return: 0 on success, or the errno of the failed fork().
+ */
+int spawn_builtin(info_t *info, builtin_table *builtin, stage_t *s, int i)
+{
+	w_flush(-1);
+	s[i].pid = fork();
+	if (s[i].pid == -1)
+		return (errno);
+	if (s[i].pid == 0)
+	{
+		fds_apply(&(info->fds));
+		stage_shed(info, s, i);
+		ev_child(info);
+		if (builtin->func(info) == -2 && info->err_num != -1)
+			info->status = info->err_num; /* exit N */
+		w_flush(-1);
+		_exit(info->status);
+	}
+	return (0);
+}
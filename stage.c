@@ -0,0 +1,174 @@
+/*
+ * File_name: stage.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * stage_start - Starts one stage of a pipeline without waiting for it.
+ *
+ * @info: The parameter struct holding the lexed line.
+ * @all: The pipeline's stages; those before @i are started.
+ * @i: Index of the stage to start; its tok, in and out must be set, and
+ *     if out is a pipe, the next stage's in must be its read end. Its
+ *     argv, argc, pid and status are filled in.
+ *
+ * External commands and builtins that change the shell are started in
+ * a child. A builtin that only reports on the shell is not run yet: its
+ * pid is set to -1 and stage_run() runs it once every stage is going.
+ * In the background every stage gets a child.
+ *
+ * Return: Index of the '|' ending the stage, or lex.end for the last.
+ */
+int stage_start(info_t *info, stage_t *all, int i)
+{
+	stage_t *s = &all[i];
+	fdmap_t *fds = &(info->fds);
+	builtin_table *builtin;
+	int end = set_argv(info, s->tok), err;
+
+	s->argv = info->argv, s->argc = info->argc;
+	s->pid = 0;
+	builtin = builtin_lookup(info->argv[0]);
+	if (builtin && builtin->inproc && !info->lex.bg)
+		return (s->pid = -1, end);
+	fds->n = 0;
+	if (s->in != -1)
+		fds->fd[fds->n] = STDIN_FILENO, fds->own[fds->n] = 0,
+			fds->to[fds->n++] = s->in;
+	if (s->out != -1)
+		fds->fd[fds->n] = STDOUT_FILENO, fds->own[fds->n] = 0,
+			fds->to[fds->n++] = s->out;
+	if (redir_open(info, s->tok))
+		return (s->status = info->status, end);
+	if (builtin)
+	{
+		err = spawn_builtin(info, builtin, all, i);
+		if (err)
+			errno = err, perror("fork"), info->status = 1;
+	}
+	else
+	{
+		info->async_pid = &(s->pid);
+		find_cmd(info);
+		info->async_pid = NULL;
+	}
+	redir_close(info);
+	s->status = info->status;
+	return (end);
+}
+
+/**
+ * stage_run - Runs a builtin stage inside the shell.
+ *
+ * @info: The parameter struct.
+ * @s: A stage stage_start() left waiting; its write end is closed here.
+ *
+ * Only the writers are pointed at the stage's pipe and redirections;
+ * the shell's descriptors stay as they are. Such builtins never read
+ * stdin, so the read end was already closed. SIGPIPE is ignored while
+ * it runs, so a reader that has gone away just makes its writes fail.
+ */
+void stage_run(info_t *info, stage_t *s)
+{
+	builtin_table *builtin = builtin_lookup(s->argv[0]);
+	fdmap_t *fds = &(info->fds);
+	void (*old)(int) = SIG_DFL;
+
+	info->argv = s->argv, info->argc = s->argc;
+	fds->n = 0;
+	if (s->out != -1)
+	{
+		fds->fd[0] = STDOUT_FILENO, fds->own[0] = 0;
+		fds->to[fds->n++] = s->out;
+		old = signal(SIGPIPE, SIG_IGN);
+	}
+	s->status = info->status;
+	if (!redir_open(info, s->tok))
+	{
+		redir_writers(info, 1);
+		s->status = builtin->func(info);
+		redir_writers(info, 0);
+	}
+	redir_close(info);
+	if (s->out != -1)
+		signal(SIGPIPE, old), close(s->out);
+	s->out = -1;
+	s->pid = 0;
+}
+
+/**
+ * stage_wait - Waits for every stage and publishes their statuses.
+ *
+ * @info: The parameter struct.
+ * @s: The stages; a pid of 0 means there is nothing to wait for.
+ * @n: The number of stages.
+ *
+ * The pipeline's status is that of its last stage; all of them are put
+ * in PIPESTATUS, separated by spaces. That is a shell variable only, so
+ * it is not exported to the commands the shell runs.
+ */
+void stage_wait(info_t *info, stage_t *s, int n)
+{
+	char *all = arena_alloc(&(info->arena), n * 12);
+	int i, w;
+
+	for (i = 0; i < n; i++)
+	{
+		if (s[i].pid > 0 && waitpid(s[i].pid, &w, 0) != -1)
+			s[i].status = WIFEXITED(w) ? WEXITSTATUS(w)
+				: 128 + WTERMSIG(w);
+		if (!all)
+			continue;
+		if (!i)
+			*all = '\0';
+		_strcat(all, convert_number(s[i].status, 10, 0));
+		if (i < n - 1)
+			_strcat(all, " ");
+	}
+	if (n)
+		info->status = s[n - 1].status;
+	if (all && n)
+		free(info->pipestatus), info->pipestatus = _strdup(all);
+}
+
+/**
+ * stage_shed - Closes the shell's own descriptors in a forked stage.
+ *
+ * @info: The parameter struct; its moves have just been made.
+ * @s: The pipeline's stages.
+ * @i: Index of the stage the child runs.
+ *
+ * Only what the shell is known to hold is closed: the descriptors moved
+ * into place, the read end of the stage's own pipe (the next stage's
+ * in), the write ends kept for builtins still to run in the shell, the
+ * event descriptors and a script being read. Nothing else is open in a
+ * pipeline, so the fd table is not scanned.
+ */
+void stage_shed(info_t *info, stage_t *s, int i)
+{
+	fdmap_t *fds = &(info->fds);
+	int j, k;
+
+	for (j = 0; j < fds->n; j++)
+	{
+		for (k = 0; k < fds->n && fds->fd[k] != fds->to[j]; k++)
+			;
+		if (fds->to[j] > 2 && k == fds->n)
+			close(fds->to[j]);
+	}
+	fds->n = 0; /* what it starts inherits them as they are */
+	if (s[i].out != -1)
+		close(s[i + 1].in);
+	for (j = 0; j < i; j++)
+		if (s[j].pid == -1 && s[j].out != -1)
+			close(s[j].out);
+	if (info->ev.ep != -1)
+		close(info->ev.ep), close(info->ev.sig);
+	if (info->ev.timer != -1)
+		close(info->ev.timer);
+	if (info->readfd > 2)
+		close(info->readfd);
+}
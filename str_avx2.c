@@ -0,0 +1,124 @@
+/*
+ * File_name: str_avx2.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+#ifdef STR_SIMD
+#include <immintrin.h>
+
+/**
+ * str_avx2_len - Measures a string thirty-two bytes at a time.
+ *
+ * @s: The string.
+ *
+ * Every load is an aligned 32 bytes, starting at or before @s, so it may
+ * read past the terminator but never into the next page.
+ *
+ * Return: The length of @s.
+ */
+NO_ASAN STR_AVX2_FN size_t str_avx2_len(const char *s)
+{
+	const char *p = (const char *)((size_t)s & ~(size_t)31);
+	__m256i z = _mm256_setzero_si256(), v;
+	unsigned int m;
+
+	v = _mm256_load_si256((const __m256i *)p);
+	m = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, z))
+		>> (s - p);
+	if (m)
+		return (__builtin_ctz(m));
+	do {
+		p += 32;
+		v = _mm256_load_si256((const __m256i *)p);
+		m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, z));
+	} while (!m);
+	return (p + __builtin_ctz(m) - s);
+}
+
+/**
+ * str_avx2_chr - Finds a character in a string 32 bytes at a time.
+ *
+ * @s: The string.
+ * @c: The character; '\0' finds the terminator.
+ *
+ * Loads are aligned as in str_avx2_len().
+ *
+ * Return: The first @c in @s, or NULL if there is none.
+ */
+NO_ASAN STR_AVX2_FN char *str_avx2_chr(const char *s, char c)
+{
+	const char *p = (const char *)((size_t)s & ~(size_t)31);
+	__m256i z = _mm256_setzero_si256(), k = _mm256_set1_epi8(c), v;
+	unsigned int m;
+
+	v = _mm256_load_si256((const __m256i *)p);
+	v = _mm256_or_si256(_mm256_cmpeq_epi8(v, z), _mm256_cmpeq_epi8(v, k));
+	m = (unsigned int)_mm256_movemask_epi8(v) >> (s - p);
+	while (!m)
+	{
+		s = p += 32;
+		v = _mm256_load_si256((const __m256i *)p);
+		v = _mm256_or_si256(_mm256_cmpeq_epi8(v, z),
+				_mm256_cmpeq_epi8(v, k));
+		m = _mm256_movemask_epi8(v);
+	}
+	s += __builtin_ctz(m);
+	return (*s == c ? (char *)s : NULL);
+}
+
+/**
+ * str_avx2_same - Measures the common prefix of two strings.
+ *
+ * @a: The first string.
+ * @b: The second string.
+ *
+ * The strings are compared 32 bytes at a time with unaligned loads,
+ * except within 32 bytes of the end of a page, where a load could fault
+ * past the terminator; there they go a byte at a time.
+ *
+ * Return: The index of the first byte that differs or ends @a.
+ */
+NO_ASAN STR_AVX2_FN size_t str_avx2_same(const char *a, const char *b)
+{
+	__m256i x, y, z = _mm256_setzero_si256();
+	unsigned int m;
+	size_t i = 0;
+
+	while (1)
+	{
+		if ((size_t)(a + i) % STR_PAGE > STR_PAGE - 32
+				|| (size_t)(b + i) % STR_PAGE > STR_PAGE - 32)
+		{
+			if (a[i] != b[i] || !a[i])
+				return (i);
+			i++;
+			continue;
+		}
+		x = _mm256_loadu_si256((const __m256i *)(a + i));
+		y = _mm256_loadu_si256((const __m256i *)(b + i));
+		m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y))
+			& ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, z));
+		if (m != 0xffffffffU)
+			return (i + __builtin_ctz(~m));
+		i += 32;
+	}
+}
+
+/**
+ * str_pick - Switches the string scanners to AVX2 if the CPU has it.
+ *
+ * Run once, before main(), so the string functions pay for the choice
+ * with one indirect call and never test the CPU themselves.
+ */
+__attribute__((constructor)) static void str_pick(void)
+{
+	if (!__builtin_cpu_supports("avx2"))
+		return;
+	str_len = str_avx2_len;
+	str_chr = str_avx2_chr;
+	str_same = str_avx2_same;
+}
+#endif
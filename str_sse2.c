@@ -0,0 +1,109 @@
+/*
+ * File_name: str_sse2.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+#ifdef STR_SIMD
+#include <immintrin.h>
+
+/**
+ * str_sse2_len - Measures a string sixteen bytes at a time.
+ *
+ * @s: The string.
+ *
+ * Every load is an aligned 16 bytes, starting at or before @s, so it may
+ * read past the terminator but never into the next page.
+ *
+ * Return: The length of @s.
+ */
+NO_ASAN size_t str_sse2_len(const char *s)
+{
+	const char *p = (const char *)((size_t)s & ~(size_t)15);
+	__m128i z = _mm_setzero_si128(), v;
+	unsigned int m;
+
+	v = _mm_load_si128((const __m128i *)p);
+	m = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, z))
+		>> (s - p);
+	if (m)
+		return (__builtin_ctz(m));
+	do {
+		p += 16;
+		v = _mm_load_si128((const __m128i *)p);
+		m = _mm_movemask_epi8(_mm_cmpeq_epi8(v, z));
+	} while (!m);
+	return (p + __builtin_ctz(m) - s);
+}
+
+/**
+ * str_sse2_chr - Finds a character in a string 16 bytes at a time.
+ *
+ * @s: The string.
+ * @c: The character; '\0' finds the terminator.
+ *
+ * Loads are aligned as in str_sse2_len().
+ *
+ * Return: The first @c in @s, or NULL if there is none.
+ */
+NO_ASAN char *str_sse2_chr(const char *s, char c)
+{
+	const char *p = (const char *)((size_t)s & ~(size_t)15);
+	__m128i z = _mm_setzero_si128(), k = _mm_set1_epi8(c), v;
+	unsigned int m;
+
+	v = _mm_load_si128((const __m128i *)p);
+	v = _mm_or_si128(_mm_cmpeq_epi8(v, z), _mm_cmpeq_epi8(v, k));
+	m = (unsigned int)_mm_movemask_epi8(v) >> (s - p);
+	while (!m)
+	{
+		s = p += 16;
+		v = _mm_load_si128((const __m128i *)p);
+		v = _mm_or_si128(_mm_cmpeq_epi8(v, z),
+				_mm_cmpeq_epi8(v, k));
+		m = _mm_movemask_epi8(v);
+	}
+	s += __builtin_ctz(m);
+	return (*s == c ? (char *)s : NULL);
+}
+
+/**
+ * str_sse2_same - Measures the common prefix of two strings.
+ *
+ * @a: The first string.
+ * @b: The second string.
+ *
+ * The strings are compared 16 bytes at a time with unaligned loads,
+ * except within 16 bytes of the end of a page, where a load could fault
+ * past the terminator; there they go a byte at a time.
+ *
+ * Return: The index of the first byte that differs or ends @a.
+ */
+NO_ASAN size_t str_sse2_same(const char *a, const char *b)
+{
+	__m128i x, y, z = _mm_setzero_si128();
+	unsigned int m;
+	size_t i = 0;
+
+	while (1)
+	{
+		if ((size_t)(a + i) % STR_PAGE > STR_PAGE - 16
+				|| (size_t)(b + i) % STR_PAGE > STR_PAGE - 16)
+		{
+			if (a[i] != b[i] || !a[i])
+				return (i);
+			i++;
+			continue;
+		}
+		x = _mm_loadu_si128((const __m128i *)(a + i));
+		y = _mm_loadu_si128((const __m128i *)(b + i));
+		m = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y))
+			& ~_mm_movemask_epi8(_mm_cmpeq_epi8(x, z));
+		if (m != 0xffff)
+			return (i + __builtin_ctz(~m));
+		i += 16;
+	}
+}
+#endif
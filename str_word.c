@@ -0,0 +1,105 @@
+/*
+ * File_name: str_word.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+/**
+ * str_word_len - Measures a string a word at a time.
+ *
+ * @s: The string.
+ *
+ * An aligned word never straddles a page, so reading the whole of the
+ * one holding the terminator is safe.
+ *
+ * Return: The length of @s.
+ */
+NO_ASAN size_t str_word_len(const char *s)
+{
+	const char *p = s;
+	const word_t *w;
+
+	for (; !WORD_ALIGNED(p); p++)
+		if (!*p)
+			return (p - s);
+	for (w = (const word_t *)p; !WORD_HAS_ZERO(*w); w++)
+		;
+	for (p = (const char *)w; *p; p++)
+		;
+	return (p - s);
+}
+
+/**
+ * str_word_chr - Finds a character in a string a word at a time.
+ *
+ * @s: The string.
+ * @c: The character; '\0' finds the terminator.
+ *
+ * Words are read as in str_word_len().
+ *
+ * Return: The first @c in @s, or NULL if there is none.
+ */
+NO_ASAN char *str_word_chr(const char *s, char c)
+{
+	word_t mask = WORD_ONES * (unsigned char)c;
+	const word_t *w;
+
+	for (; !WORD_ALIGNED(s); s++)
+		if (*s == c || !*s)
+			return (*s == c ? (char *)s : NULL);
+	/* skip whole words holding neither @c nor the terminator */
+	for (w = (const word_t *)s; !WORD_HAS_ZERO(*w)
+			&& !WORD_HAS_ZERO(*w ^ mask);)
+		w++;
+	for (s = (const char *)w; *s != c; s++)
+		if (!*s)
+			return (NULL);
+	return ((char *)s);
+}
+
+/**
+ * str_word_same - Measures the common prefix of two strings.
+ *
+ * @a: The first string.
+ * @b: The second string.
+ *
+ * Whole words are compared only when the strings share an alignment,
+ * so that both reads are aligned; otherwise it goes a byte at a time.
+ *
+ * Return: The index of the first byte that differs or ends @a.
+ */
+NO_ASAN size_t str_word_same(const char *a, const char *b)
+{
+	const word_t *x, *y;
+	size_t i = 0;
+
+	if ((size_t)a % WORD_SIZE == (size_t)b % WORD_SIZE)
+	{
+		for (; !WORD_ALIGNED(a + i) && a[i] && a[i] == b[i]; i++)
+			;
+		x = (const word_t *)(a + i), y = (const word_t *)(b + i);
+		if (WORD_ALIGNED(x))
+			for (; *x == *y && !WORD_HAS_ZERO(*x); x++, y++)
+				i += WORD_SIZE;
+	}
+	for (; a[i] && a[i] == b[i]; i++)
+		;
+	return (i);
+}
+
+/*
+ * The scanners the string functions call. They start out as the best
+ * every CPU of the target has; on x86-64 str_pick() may swap in AVX2
+ * before main() runs, so the choice is made once, not per call.
+ */
+#ifdef STR_SIMD
+size_t (*str_len)(const char *) = str_sse2_len;
+char *(*str_chr)(const char *, char) = str_sse2_chr;
+size_t (*str_same)(const char *, const char *) = str_sse2_same;
+#else
+size_t (*str_len)(const char *) = str_word_len;
+char *(*str_chr)(const char *, char) = str_word_chr;
+size_t (*str_same)(const char *, const char *) = str_word_same;
+#endif
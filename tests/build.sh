@@ -0,0 +1,22 @@
+#!/bin/sh
+#
+# File_name: build.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Prints the shell the test and bench scripts are to run. That is the
+# one named, made absolute, or else one built from this tree into dir
+# with the project's gcc line, plus any $CFLAGS.
+#
+# Usage: tests/build.sh "path/to/hsh or empty" dir
+
+if [ -n "$1" ]; then
+	echo "$(cd "$(dirname "$1")" && pwd)/$(basename "$1")"
+	exit 0
+fi
+top=$(cd "$(dirname "$0")/.." && pwd)
+cd "$top" || exit 1
+# shellcheck disable=SC2086
+gcc -Wall -Werror -Wextra -pedantic -std=gnu89 $CFLAGS *.c -o "$2/hsh" >&2 \
+	|| exit 1
+echo "$2/hsh"
@@ -0,0 +1,48 @@
+#!/bin/sh
+#
+# File_name: builtins.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Every X(name, c0, c1, ...) line of the BUILTINS registry in shell.h
+# must give c0 and c1 as the first two characters of name ('\0' for a
+# one-character name), since builtin lookup switches on them; the
+# compiler cannot check that itself. Each builtin must then be found by
+# type, which goes through the same lookup.
+#
+# Usage: tests/builtins.sh [path/to/hsh]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+# name c0 c1, one builtin per line, with '\0' left as \0
+ch="'\\(\\\\0\\|.\\)'"
+sed -n "s/^[[:space:]]*X(\"\([^\"]*\)\", $ch, $ch,.*/\1 \2 \3/p" \
+	"$(dirname "$0")/../shell.h" > "$dir/table"
+if [ ! -s "$dir/table" ]; then
+	echo "builtins: no X(...) lines found in shell.h"
+	exit 1
+fi
+
+fail=0
+while read -r name c0 c1; do
+	want0=$(printf '%s' "$name" | cut -c1)
+	want1=$(printf '%s' "$name" | cut -c2)
+	if [ "$c0" != "$want0" ] || [ "$c1" != "${want1:-\\0}" ]; then
+		echo "builtins: $name has c0 '$c0' and c1 '$c1'"
+		fail=1
+	fi
+	echo "type $name" >> "$dir/type.sh"
+	echo "$name is a shell builtin" >> "$dir/want"
+done < "$dir/table"
+"$hsh" "$dir/type.sh" > "$dir/got" 2>&1
+if ! cmp -s "$dir/got" "$dir/want"; then
+	echo "builtins: type does not find every builtin"
+	diff "$dir/want" "$dir/got"
+	fail=1
+fi
+[ $fail = 0 ] || exit 1
+echo "builtins: ok ($(wc -l < "$dir/table") checked)"
@@ -0,0 +1,34 @@
+#!/bin/sh
+#
+# File_name: hist_compact.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# A script that saves its history without ever loading it must still cut
+# the file back to HIST_MAX (4096) lines once it passes twice that.
+#
+# Usage: tests/hist_compact.sh [path/to/hsh]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+home=$(mktemp -d) || exit 1
+trap 'rm -rf "$home"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$home") || exit 1
+
+seq 1 9000 | sed 's/^/echo /' > "$home/.simple_shell_history"
+echo true | HOME=$home HISTSAVE=1 "$hsh"
+lines=$(wc -l < "$home/.simple_shell_history")
+if [ "$lines" -ne 4096 ]; then
+	echo "hist_compact: HISTSAVE left $lines lines, wanted 4096"
+	exit 1
+fi
+
+seq 1 8190 | sed 's/^/echo /' > "$home/.simple_shell_history"
+{ echo 'setenv HISTFLUSH 1'; seq 1 10 | sed 's/^/true /'; } |
+	HOME=$home "$hsh"
+lines=$(wc -l < "$home/.simple_shell_history")
+if [ "$lines" -gt 4107 ]; then
+	echo "hist_compact: HISTFLUSH left $lines lines, wanted at most 4107"
+	exit 1
+fi
+echo "hist_compact: ok"
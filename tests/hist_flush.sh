@@ -0,0 +1,32 @@
+#!/bin/sh
+#
+# File_name: hist_flush.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Lines a HISTFLUSH shell saved before the history was first loaded must
+# be listed, and kept in the file, once only.
+#
+# Usage: tests/hist_flush.sh [path/to/hsh]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+home=$(mktemp -d) || exit 1
+trap 'rm -rf "$home"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$home") || exit 1
+
+out=$(printf 'setenv HISTFLUSH 1\necho one\nhistory\n' | HOME=$home "$hsh")
+want='one
+0: setenv HISTFLUSH 1
+1: echo one
+2: history'
+if [ "$out" != "$want" ]; then
+	printf 'hist_flush: history listed\n%s\nwanted\n%s\n' "$out" "$want"
+	exit 1
+fi
+lines=$(wc -l < "$home/.simple_shell_history")
+if [ "$lines" -ne 3 ]; then
+	echo "hist_flush: history file has $lines lines, wanted 3"
+	exit 1
+fi
+echo "hist_flush: ok"
@@ -0,0 +1,44 @@
+#!/bin/sh
+#
+# File_name: malloc.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Counts the heap calls hsh makes for 1000 and for 10000 lines of a few
+# simple commands, and fails if the extra 9000 lines cost more than
+# LIMIT calls per 100 lines (default 0). Once the per-command arena and
+# the line buffer have grown to fit, tokenizing, expanding and running a
+# simple builtin should not touch the heap at all. Counting is done by
+# tests/malloc_count.c, loaded with LD_PRELOAD.
+#
+# Usage: tests/malloc.sh [path/to/hsh]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+limit=${LIMIT:-0}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+cc -shared -fPIC -o "$dir/malloc_count.so" \
+	"$(dirname "$0")/malloc_count.c" || exit 1
+
+fail=0
+for cmd in 'true' 'true a b $HOME $?' 'echo x'; do
+	for n in 1000 10000; do
+		seq 1 $n | sed "s/.*/$cmd/" > "$dir/cmd.sh"
+		c=$(LD_PRELOAD=$dir/malloc_count.so "$hsh" "$dir/cmd.sh" \
+			2>&1 >/dev/null | sed -n 's/^heap calls: //p' |
+			tail -n 1)
+		eval "c$n=\$c"
+	done
+	per100=$(( (c10000 - c1000) / 90 ))
+	echo "heap calls ($cmd): $c1000 for 1000 lines, $c10000 for 10000," \
+		"$per100 per 100 lines"
+	[ "$per100" -le "$limit" ] || fail=1
+done
+if [ $fail != 0 ]; then
+	echo "malloc: over $limit per 100 lines"
+	exit 1
+fi
+echo "malloc: ok"
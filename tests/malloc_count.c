@@ -0,0 +1,84 @@
+/*
+ * File_name: malloc_count.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <unistd.h>
+
+void *__libc_malloc(size_t);
+void *__libc_calloc(size_t, size_t);
+void *__libc_realloc(void *, size_t);
+void __libc_free(void *);
+
+static unsigned long calls;
+
+/**
+ * malloc - Counts a call, then allocates as glibc does.
+ *
+ * @size: The number of bytes.
+ *
+ * Return: The new block, or NULL.
+ */
+void *malloc(size_t size)
+{
+	calls++;
+	return (__libc_malloc(size));
+}
+
+/**
+ * calloc - Counts a call, then allocates zeroed memory as glibc does.
+ *
+ * @n: The number of members.
+ * @size: The size of each.
+ *
+ * Return: The new block, or NULL.
+ */
+void *calloc(size_t n, size_t size)
+{
+	calls++;
+	return (__libc_calloc(n, size));
+}
+
+/**
+ * realloc - Counts a call, then resizes as glibc does.
+ *
+ * @p: The block, or NULL.
+ * @size: The new size.
+ *
+ * Return: The block, maybe moved, or NULL.
+ */
+void *realloc(void *p, size_t size)
+{
+	calls++;
+	return (__libc_realloc(p, size));
+}
+
+/**
+ * free - Counts a call, then frees as glibc does.
+ *
+ * @p: The block, or NULL (which is not counted).
+ */
+void free(void *p)
+{
+	calls += p != NULL;
+	__libc_free(p);
+}
+
+/**
+ * report - Prints the count when the process exits.
+ *
+ * Loaded with LD_PRELOAD, this counts every heap call a program makes,
+ * including those of libc itself, and prints "heap calls: N" to stderr
+ * at exit. Forked children print their own count.
+ */
+__attribute__((destructor)) static void report(void)
+{
+	char buf[64];
+	int n = snprintf(buf, sizeof(buf), "heap calls: %lu\n", calls);
+
+	if (write(STDERR_FILENO, buf, n) == -1)
+		return;
+}
@@ -0,0 +1,25 @@
+#!/bin/sh
+#
+# File_name: pipe_sleep.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# The stages of a pipeline run at once, builtins included, so
+# 'sleep 1 | sleep 1' must take about one second, not two.
+#
+# Usage: tests/pipe_sleep.sh [path/to/hsh]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+start=$(date +%s%N)
+echo 'sleep 1 | sleep 1' | "$hsh"
+ms=$(( ($(date +%s%N) - start) / 1000000 ))
+if [ "$ms" -ge 1500 ]; then
+	echo "pipe_sleep: 'sleep 1 | sleep 1' took $ms ms, wanted under 1500"
+	exit 1
+fi
+echo "pipe_sleep: ok"
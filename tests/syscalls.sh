@@ -0,0 +1,63 @@
+#!/bin/sh
+#
+# File_name: syscalls.sh
+# Auth: Ephraim Eyram
+#       and Abigail Nyarkoh
+#
+# Counts the system calls hsh makes for 1000 and for 10000 lines of a
+# simple builtin, read from a script file and from a pipe, and fails if
+# the extra 9000 lines cost more than LIMIT calls per 100 lines (default
+# 1). The shell is meant to make none per line once it is running:
+# interactivity is decided once, the SIGINT handler installed once, and
+# input read in large blocks. A builtin forked as a pipeline stage
+# ('wait | cat') must also cost no more than 20 calls over an external
+# one ('true | cat'): it closes the shell's descriptors by name, not by
+# trying every one. Counting is done by tests/syscount.c, which works
+# like strace -c -f.
+#
+# Usage: tests/syscalls.sh [path/to/hsh]
+#
+# Without a path (or with ""), the shell is built from this tree first.
+
+limit=${LIMIT:-1}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+hsh=$("$(dirname "$0")/../tests/build.sh" "$1" "$dir") || exit 1
+
+cc -o "$dir/syscount" "$(dirname "$0")/syscount.c" || exit 1
+for n in 1000 10000; do
+	seq 1 $n | sed 's/.*/true/' > "$dir/true$n.sh"
+done
+
+count()
+{
+	"$dir/syscount" "$@" 2>&1 >/dev/null | sed -n 's/^syscalls: //p'
+}
+
+fail=0
+for how in file pipe; do
+	for n in 1000 10000; do
+		if [ $how = file ]; then
+			c=$(count "$hsh" "$dir/true$n.sh")
+		else
+			c=$(cat "$dir/true$n.sh" | count "$hsh")
+		fi
+		eval "c$n=\$c"
+	done
+	per100=$(( (c10000 - c1000) / 90 ))
+	echo "syscalls ($how): $c1000 for 1000 lines, $c10000 for 10000," \
+		"$per100 per 100 lines"
+	[ "$per100" -le "$limit" ] || fail=1
+done
+if [ $fail != 0 ]; then
+	echo "syscalls: over $limit per 100 lines"
+	exit 1
+fi
+ext=$(echo 'true | cat' | count "$hsh")
+fork=$(echo 'wait | cat' | count "$hsh")
+echo "syscalls (stage): $ext for 'true | cat', $fork for 'wait | cat'"
+if [ "$fork" -gt $((ext + 20)) ]; then
+	echo "syscalls: forked builtin stage over 20 more than an external one"
+	exit 1
+fi
+echo "syscalls: ok"
@@ -0,0 +1,87 @@
+/*
+ * File_name: syscount.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include <sys/ptrace.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define SYSCALL_STOP (SIGTRAP | 0x80)
+
+/**
+ * trace_child - Runs a command under ptrace, stopped before it starts.
+ *
+ * @av: The command and its arguments.
+ *
+ * Return: The child's pid, or -1 if it cannot be started.
+ */
+static pid_t trace_child(char **av)
+{
+	pid_t pid = fork();
+	int st;
+	long opts = PTRACE_O_TRACESYSGOOD | PTRACE_O_TRACEFORK
+		| PTRACE_O_TRACEVFORK | PTRACE_O_TRACECLONE | PTRACE_O_EXITKILL;
+
+	if (pid == 0)
+	{
+		ptrace(PTRACE_TRACEME, 0, NULL, NULL);
+		raise(SIGSTOP);
+		execvp(av[0], av);
+		perror(av[0]);
+		_exit(127);
+	}
+	if (pid == -1 || waitpid(pid, &st, 0) == -1)
+		return (-1);
+	if (ptrace(PTRACE_SETOPTIONS, pid, NULL, (void *)opts) == -1)
+		return (-1);
+	ptrace(PTRACE_SYSCALL, pid, NULL, NULL);
+	return (pid);
+}
+
+/**
+ * main - Counts the system calls a command and its children make.
+ *
+ * @ac: The argument count.
+ * @av: syscount command [arg...]
+ *
+ * Like strace -c -f, but only the total is kept, and it is printed to
+ * stderr as "syscalls: N" once every traced process has gone. Each call
+ * stops the tracee on entry and on exit, so the stops are halved.
+ *
+ * Return: The command's exit status, or 127 if it cannot be traced.
+ */
+int main(int ac, char **av)
+{
+	pid_t pid, top;
+	int st, sig, code = 127;
+	long stops = 0;
+
+	if (ac < 2)
+		return (fprintf(stderr, "usage: syscount command...\n"), 2);
+	top = trace_child(av + 1);
+	if (top == -1)
+		return (perror("syscount"), 127);
+	while ((pid = waitpid(-1, &st, __WALL)) != -1)
+	{
+		if (WIFEXITED(st) || WIFSIGNALED(st))
+		{
+			if (pid == top)
+				code = WIFEXITED(st) ? WEXITSTATUS(st) : 128
+					+ WTERMSIG(st);
+			continue;
+		}
+		sig = WSTOPSIG(st);
+		stops += sig == SYSCALL_STOP;
+		if (sig == SYSCALL_STOP || sig == SIGTRAP || sig == SIGSTOP)
+			sig = 0;
+		ptrace(PTRACE_SYSCALL, pid, NULL, (void *)(long)sig);
+	}
+	fprintf(stderr, "syscalls: %ld\n", (stops + 1) / 2);
+	return (code);
+}
@@ -6,63 +6,6 @@
 
 #include "shell.h"
 
-/**
- * **strtow - Transform a string into an array of unique words,
- * ignoring repeat delimiters.
- *
- * @str: The input string to be split.
- * @d: The delimiter string to determine word boundaries.
- *
- * This function takes an input string and a delimiter string,
- * then splits the input
- * string into an array of unique words, ignoring repeated delimiters.
- * It returns a pointer to the array of strings containing the words,
- * or NULL on failure.
- *
- * Return: A pointer to an array of strings or NULL if unsuccessful.
- */
-char **strtow(char *str, char *d)
-
-{
-	int i, j, k, m, numwords = 0;
-	char **s;
-
-	if (str == NULL || str[0] == 0)
-		return (NULL);
-	if (!d)
-		d = " ";
-	for (i = 0; str[i] != '\0'; i++)
-		if (!is_delim(str[i], d) && (is_delim(str[i + 1], d) || !str[i + 1]))
-			numwords++;
-
-	if (numwords == 0)
-		return (NULL);
-	s = malloc((1 + numwords) * sizeof(char *));
-	if (!s)
-		return (NULL);
-	for (i = 0, j = 0; j < numwords; j++)
-	{
-		while (is_delim(str[i], d))
-			i++;
-		k = 0;
-		while (!is_delim(str[i + k], d) && str[i + k])
-			k++;
-		s[j] = malloc((k + 1) * sizeof(char));
-		if (!s[j])
-		{
-			for (k = 0; k < j; k++)
-				free(s[k]);
-			free(s);
-			return (NULL);
-		}
-		for (m = 0; m < k; m++)
-			s[j][m] = str[i++];
-		s[j][m] = 0;
-	}
-	s[j] = NULL;
-	return (s);
-}
-
 /**
  * **strtow2 - Transform a string into a graceful array of words.
  *
@@ -113,3 +56,63 @@ char **strtow2(char *str, char d)
 	s[j] = NULL;
 	return (s);
 }
+
+/**
+ * split_words - Splits a string into blank-separated words in place.
+ *
+ * @s: The string.
+ * @w: Where the words are stored, NULL-terminated, or NULL just to
+ *     count them; only then is @s cut up.
+ *
+ * Call it once without @w to size the array, then again to fill it, so
+ * the words need no allocation of their own.
+ *
+ * Return: The number of words.
+ */
+int split_words(char *s, char **w)
+{
+	int n = 0;
+
+	while (*s)
+	{
+		for (; *s == ' ' || *s == '\t'; s++)
+			;
+		if (!*s)
+			break;
+		if (w)
+			w[n] = s;
+		n++;
+		for (; *s && *s != ' ' && *s != '\t'; s++)
+			;
+		if (*s && w)
+			*s++ = '\0';
+	}
+	if (w)
+		w[n] = NULL;
+	return (n);
+}
+
+/**
+ * lex_drop - Reports a line that cannot be run, and drops it.
+ *
+ * @info: The parameter struct holding the lexed line.
+ * @msg: What went wrong, ending in a newline.
+ *
+ * The line is counted and reported the way a syntax error is. Its
+ * tokens are discarded, so none of it runs, and the status is 1.
+ *
+ * Return: Always 1.
+ */
+int lex_drop(info_t *info, char *msg)
+{
+	lex_t *lx = &(info->lex);
+
+	if (info->linecount_flag)
+		info->line_count++, info->linecount_flag = 0;
+	_eputs(info->fname), _eputs(": ");
+	print_d(info->line_count, STDERR_FILENO);
+	_eputs(": "), _eputs(msg);
+	lx->count = lx->pos = lx->docs = 0;
+	lx->line[0] = '\0', lx->eol = 0;
+	return (info->status = 1);
+}
@@ -0,0 +1,150 @@
+/*
+ * File_name: writer.c
+ * Auth: Ephraim Eyram
+ *       and Abigail Nyarkoh
+ */
+
+#include "shell.h"
+
+static writer_t writers[WRITERS] = {
+	{STDOUT_FILENO, STDOUT_FILENO, 0, {0}},
+	{STDERR_FILENO, STDERR_FILENO, 0, {0}}, {-1, -1, 0, {0}}
+};
+
+/**
+ * w_drain - Writes out a set of pieces, retrying short writes.
+ *
+ * @fd: The file descriptor to write to.
+ * @iov: The pieces; advanced in place as they are written.
+ * @n: The number of pieces.
+ *
+ * Return: 0 on success, -1 on a write error.
+ */
+static int w_drain(int fd, struct iovec *iov, int n)
+{
+	ssize_t r;
+
+	while (n)
+	{
+		r = writev(fd, iov, n);
+		if (r == -1 && errno == EINTR)
+			continue;
+		if (r == -1)
+			return (-1);
+		for (; n && (size_t)r >= iov->iov_len; iov++, n--)
+			r -= iov->iov_len;
+		if (n)
+		{
+			iov->iov_base = (char *)iov->iov_base + r;
+			iov->iov_len -= r;
+		}
+	}
+	return (0);
+}
+
+/**
+ * w_slot - Finds the writer buffering a file descriptor.
+ *
+ * @fd: The file descriptor.
+ *
+ * stdout and stderr have writers of their own; any other descriptor
+ * shares the last one, which is flushed before it changes hands so no
+ * bytes end up in the wrong file.
+ *
+ * Return: The writer for @fd.
+ */
+static writer_t *w_slot(int fd)
+{
+	writer_t *w = &writers[WRITERS - 1];
+
+	if (fd == STDOUT_FILENO || fd == STDERR_FILENO)
+		return (&writers[fd - 1]);
+	if (w->fd != fd)
+	{
+		if (w->fd != -1)
+			w_flush(w->fd);
+		w->fd = w->to = fd;
+	}
+	return (w);
+}
+
+/**
+ * w_write - Buffers bytes for a file descriptor.
+ *
+ * @fd: The file descriptor to write to.
+ * @s: The bytes.
+ * @n: How many bytes.
+ *
+ * Small writes are copied into the buffer. One that does not fit goes
+ * out together with what is already buffered in a single writev(), so
+ * a long string is never copied.
+ *
+ * Return: @n on success, -1 on a write error.
+ */
+ssize_t w_write(int fd, const char *s, size_t n)
+{
+	writer_t *w = w_slot(fd);
+	struct iovec iov[2];
+
+	if (w->len + n <= WRITE_BUF_SIZE)
+	{
+		memcpy(w->buf + w->len, s, n);
+		w->len += n;
+		return (n);
+	}
+	iov[0].iov_base = w->buf;
+	iov[0].iov_len = w->len;
+	iov[1].iov_base = (char *)s;
+	iov[1].iov_len = n;
+	w->len = 0;
+	return (w_drain(w->to, iov, 2) ? -1 : (ssize_t)n);
+}
+
+/**
+ * w_flush - Writes out what is buffered for a file descriptor.
+ *
+ * @fd: The file descriptor, or -1 to flush every writer (as before a
+ *      fork, so a child never inherits pending output).
+ *
+ * Nothing is written when the buffer is empty.
+ *
+ * Return: 0 on success, -1 on a write error.
+ */
+int w_flush(int fd)
+{
+	struct iovec iov;
+	writer_t *w;
+	int i, ret = 0;
+
+	for (i = 0; i < WRITERS; i++)
+	{
+		w = &writers[i];
+		if (w->fd == -1 || !w->len || (fd != -1 && fd != w->fd))
+			continue;
+		iov.iov_base = w->buf;
+		iov.iov_len = w->len;
+		w->len = 0;
+		if (w_drain(w->to, &iov, 1))
+			ret = -1;
+	}
+	return (ret);
+}
+
+/**
+ * w_redirect - Sends what is written for stdout or stderr elsewhere.
+ *
+ * @fd: STDOUT_FILENO or STDERR_FILENO.
+ * @to: The descriptor its output should go to from now on; @fd itself
+ *      puts it back.
+ *
+ * What was buffered before is flushed to the old target first, unless
+ * the target does not change. This is how a builtin's output is pointed
+ * at a pipe or file without touching the shell's own descriptors.
+ */
+void w_redirect(int fd, int to)
+{
+	if (writers[fd - 1].to == to)
+		return;
+	w_flush(fd);
+	writers[fd - 1].to = to;
+}